@@ -4,14 +4,25 @@
 #include <limits>
 #include <stdexcept>
 
+#include "Probe.hpp"
+
 namespace Filters
 {
 namespace Avg
 {
 
-class MovingAverageFilter
+class MovingAverageFilter : private Instr::Probe
 {
 public:
+    // Compact snapshot of the filter: everything except the window contents,
+    // which are rebuilt from the input series on restore.
+    struct State
+    {
+        double      sum{0.0};
+        std::size_t idx{0};
+        bool        initialized{false};
+    };
+
     explicit MovingAverageFilter(std::size_t windowSize = 100)
     {
         setWindowSize(windowSize);
@@ -21,6 +32,9 @@ public:
     // Update with a new sample; returns the current moving average.
     double update(double x);
 
+    // Block version of update over n samples; writes n averages to y.
+    void process(const double* x, double* y, std::size_t n);
+
     // Reset to "first run" state (next update(x) will fill buffer with x).
     void reset();
 
@@ -37,9 +51,20 @@ public:
 
     std::size_t getWindowSize() const { return m_n; }
 
+    State getState() const { return State{m_sum, m_idx, m_initialized}; }
+
+    // Restore a state captured after `count` updates fed with x[0..count),
+    // starting from first-run state; the window is rebuilt from the last
+    // getWindowSize() of those samples.
+    void setState(const State& s, const double* x, std::size_t count);
+
     // If not initialized yet (no Update called), returns 0.0 by convention.
     double getAverage() const { return (m_initialized ? (m_sum / static_cast<double>(m_n)) : 0.0); }
 
+    // Instrumentation counters (all zero unless built with FILTERS_ENABLE_INSTRUMENTATION).
+    Instr::Snapshot getStats() const { return probe().snapshot(); }
+    void resetStats() { probe().reset(); }
+
 private:
     std::size_t   m_n{100};
     std::vector<double> m_buf;
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include <stdexcept>
+
+#include "Probe.hpp"
+
+namespace Filters
+{
+namespace Avg
+{
+
+// Moving averages of one signal over several window sizes at once. A single
+// ring buffer sized for the largest window is shared, with one running sum per
+// window, so e.g. windows {10, 100, 1000, 10000} store 10000 samples instead
+// of 11110. Each window behaves exactly like MovingAverageFilter(N), including
+// the first-run fill.
+class MultiWindowMovingAverageFilter : private Instr::Probe
+{
+public:
+    explicit MultiWindowMovingAverageFilter(const std::vector<std::size_t>& windowSizes)
+    {
+        setWindowSizes(windowSizes);
+    }
+
+    // Update with a new sample; writes one average per window (in the order
+    // given to the constructor) to y.
+    void update(double x, double* y);
+
+    // Block version of update over n samples; y[w][0..n) receives window w.
+    void process(const double* x, double* const* y, std::size_t n);
+
+    // Reset to "first run" state (next update(x) will fill the buffer with x).
+    void reset();
+
+    // Change window sizes; resets the filter to first-run state.
+    void setWindowSizes(const std::vector<std::size_t>& windowSizes);
+
+    const std::vector<std::size_t>& getWindowSizes() const { return m_n; }
+    std::size_t getWindowCount() const { return m_n.size(); }
+
+    // Capacity of the shared ring buffer (the largest window size).
+    std::size_t getBufferSize() const { return m_buf.size(); }
+
+    // If not initialized yet (no update called), returns 0.0 by convention.
+    double getAverage(std::size_t w) const
+    {
+        return (m_initialized ? (m_sum[w] / static_cast<double>(m_n[w])) : 0.0);
+    }
+
+    // Instrumentation counters (all zero unless built with FILTERS_ENABLE_INSTRUMENTATION).
+    Instr::Snapshot getStats() const { return probe().snapshot(); }
+    void resetStats() { probe().reset(); }
+
+private:
+    // First-run state: ring filled with x, sum_w = N_w * x.
+    void prime(double x);
+
+    std::vector<std::size_t> m_n;       // window sizes
+    std::vector<double>      m_sum;     // running sum per window
+    std::vector<double>      m_buf;     // shared ring, size = max window
+    std::size_t              m_idx{0};  // ring index of the slot written next
+    bool                     m_initialized{false};
+};
+
+} // namespace Avg
+} // namespace Filters
@@ -1,13 +1,16 @@
 #pragma once
 #include <cstdint>
+#include <cstddef>
 #include <limits>
 
+#include "Probe.hpp"
+
 namespace Filters
 {
 namespace Avg
 {
 
-class RunningAverageFilter
+class RunningAverageFilter : private Instr::Probe
 {
 public:
     RunningAverageFilter()
@@ -18,6 +21,9 @@ public:
     // Feed one sample; returns updated average
     double update(double x);
 
+    // Block version of update over n samples; writes n averages to y.
+    void process(const double* x, double* y, std::size_t n);
+
     // Reset to initial state
     void reset()
     {
@@ -33,6 +39,10 @@ public:
         return (m_k > 1) ? (m_k - 1) : 0;
     }
 
+    // Instrumentation counters (all zero unless built with FILTERS_ENABLE_INSTRUMENTATION).
+    Instr::Snapshot getStats() const { return probe().snapshot(); }
+    void resetStats() { probe().reset(); }
+
 private:
     double m_prevAvg;
     std::uint64_t m_k;
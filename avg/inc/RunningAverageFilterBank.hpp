@@ -0,0 +1,63 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <vector>
+
+#include "Probe.hpp"
+
+namespace Filters
+{
+namespace Avg
+{
+
+// RunningAverageFilter over many channels that are fed in lockstep. State is
+// stored channel-contiguous (SoA) and the sample index k is shared, so every
+// frame or block needs only one reciprocal per sample index for all channels.
+class RunningAverageFilterBank : private Instr::Probe
+{
+public:
+    explicit RunningAverageFilterBank(std::size_t channels)
+    {
+        if (channels == 0) { throw std::invalid_argument("channels must be > 0"); }
+        m_avg.assign(channels, 0.0);
+        reset();
+    }
+
+    // Feed one frame x[0..channels); writes the updated averages to y.
+    void update(const double* x, double* y);
+
+    // Feed n frames given as one contiguous column per channel:
+    // x[c][0..n) in, y[c][0..n) out (y[c] may alias x[c]).
+    void process(const double* const* x, double* const* y, std::size_t n);
+
+    // Reset all channels to initial state
+    void reset()
+    {
+        std::fill(m_avg.begin(), m_avg.end(), 0.0);
+        m_k = 1;
+    }
+
+    std::size_t getChannels() const { return m_avg.size(); }
+
+    double getAverage(std::size_t channel) const { return m_avg[channel]; }
+
+    std::uint64_t getCount() const
+    {
+        // Number of frames incorporated so far
+        return (m_k > 1) ? (m_k - 1) : 0;
+    }
+
+    // Instrumentation counters; samples count channel values (frames * channels).
+    Instr::Snapshot getStats() const { return probe().snapshot(); }
+    void resetStats() { probe().reset(); }
+
+private:
+    std::vector<double> m_avg;      // per-channel running average
+    std::vector<double> m_recip;    // scratch: 1/k table for the current block
+    std::uint64_t       m_k{1};     // shared sample index (starts at 1)
+};
+
+} // namespace Avg
+} // namespace Filters
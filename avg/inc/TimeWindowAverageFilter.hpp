@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <stdexcept>
+
+#include "Probe.hpp"
+
+namespace Filters
+{
+namespace Avg
+{
+
+// Moving average over a trailing time window instead of a fixed sample count,
+// for timestamped input with jitter or gaps.
+class TimeWindowAverageFilter : private Instr::Probe
+{
+public:
+    explicit TimeWindowAverageFilter(double window = 1.0)
+    {
+        setWindow(window);
+    }
+
+    // Update with a timestamped sample; returns the mean of all samples with
+    // timestamps in (t - window, t]. A sample older than the newest one seen
+    // is dropped and the current average returned.
+    double updateAt(double t, double x);
+
+    // Block version of updateAt over n (t, x) pairs; writes n averages to y.
+    void processAt(const double* t, const double* x, double* y, std::size_t n);
+
+    // Drop all buffered samples.
+    void reset()
+    {
+        m_samples.clear();
+        m_sum = 0.0;
+    }
+
+    // Change window length (same unit as t); resets the filter.
+    void setWindow(double window)
+    {
+        if (!(window > 0.0)) { throw std::invalid_argument("window must be > 0"); }
+        m_window = window;
+        reset();
+    }
+
+    double getWindow() const { return m_window; }
+
+    // Number of samples currently inside the window.
+    std::size_t getCount() const { return m_samples.size(); }
+
+    // If no samples are buffered, returns 0.0 by convention.
+    double getAverage() const
+    {
+        return m_samples.empty() ? 0.0 : (m_sum / static_cast<double>(m_samples.size()));
+    }
+
+    // Instrumentation counters (all zero unless built with FILTERS_ENABLE_INSTRUMENTATION).
+    Instr::Snapshot getStats() const { return probe().snapshot(); }
+    void resetStats() { probe().reset(); }
+
+private:
+    struct Sample
+    {
+        double t;
+        double x;
+    };
+
+    double             m_window{1.0};
+    std::deque<Sample> m_samples;     // samples inside the window, oldest first
+    double             m_sum{0.0};    // running sum of m_samples[i].x
+};
+
+} // namespace Avg
+} // namespace Filters
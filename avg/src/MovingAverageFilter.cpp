@@ -1,5 +1,7 @@
 #include "MovingAverageFilter.hpp"
 
+#include <algorithm>
+
 
 /*
 Moving Average (fixed window, MATLAB-compatible initialization) : https://drive.google.com/drive/folders/1oJkDBsuNRK-pCmI6lTG5O2f0DuqpBGG4
@@ -32,6 +34,8 @@ namespace Avg
 
 double MovingAverageFilter::update(double x)
 {
+    probe().addSamples(1);
+
     if (!m_initialized)
     {
         // First run: fill the buffer with x (matches MATLAB behavior)
@@ -51,6 +55,39 @@ double MovingAverageFilter::update(double x)
     return m_sum / static_cast<double>(m_n);
 }
 
+void MovingAverageFilter::process(const double* x, double* y, std::size_t n)
+{
+    Instr::BlockTimer timer(probe(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = update(x[i]);
+    }
+}
+
+/*
+Restoring a snapshot: after the first-run fill at k = 0, update k >= 1 writes
+x[k] into slot (k - 1) % n. So after `count` updates the buffer holds x[0]
+everywhere except the slots overwritten by the last min(count - 1, n) samples.
+*/
+void MovingAverageFilter::setState(const State& s, const double* x, std::size_t count)
+{
+    if (!s.initialized || count == 0)
+    {
+        reset();
+        return;
+    }
+
+    std::fill(m_buf.begin(), m_buf.end(), x[0]);
+    const std::size_t first = (count > m_n) ? (count - m_n) : 1;
+    for (std::size_t k = first; k < count; ++k)
+    {
+        m_buf[(k - 1) % m_n] = x[k];
+    }
+    m_sum = s.sum;
+    m_idx = s.idx;
+    m_initialized = true;
+}
+
 void MovingAverageFilter::reset()
 {
     m_sum = 0.0;
@@ -0,0 +1,122 @@
+#include "MultiWindowMovingAverageFilter.hpp"
+
+#include <algorithm>
+
+/*
+Multi-resolution moving average over one shared ring buffer.
+
+The ring holds the last M = max(N_w) samples; m_idx is the slot written next,
+so the sample written j updates ago sits at (m_idx - j) mod M. For a window N
+the sample leaving the window is the one written N updates ago:
+
+    old_w  = buf[(idx + M - N_w) % M]
+    sum_w  = sum_w + x - old_w
+    avg_w  = sum_w / N_w
+
+after which x is stored at buf[idx] and idx advances. For N_w = M this is the
+same slot MovingAverageFilter replaces, and the arithmetic is identical, so
+every window matches a separate MovingAverageFilter(N_w).
+
+First run: the whole ring is filled with x and sum_w = N_w * x.
+*/
+
+namespace Filters
+{
+namespace Avg
+{
+
+void MultiWindowMovingAverageFilter::setWindowSizes(const std::vector<std::size_t>& windowSizes)
+{
+    if (windowSizes.empty()) { throw std::invalid_argument("at least one window size is required"); }
+    for (std::size_t n : windowSizes)
+    {
+        if (n == 0) { throw std::invalid_argument("windowSize must be > 0"); }
+    }
+
+    m_n = windowSizes;
+    m_sum.assign(m_n.size(), 0.0);
+    m_buf.assign(*std::max_element(m_n.begin(), m_n.end()), 0.0);
+    reset();
+}
+
+void MultiWindowMovingAverageFilter::reset()
+{
+    std::fill(m_sum.begin(), m_sum.end(), 0.0);
+    m_idx = 0;
+    m_initialized = false;
+    // m_buf is kept allocated; contents will be filled on first update
+}
+
+void MultiWindowMovingAverageFilter::prime(double x)
+{
+    // First run: fill the buffer with x (matches MovingAverageFilter)
+    std::fill(m_buf.begin(), m_buf.end(), x);
+    for (std::size_t w = 0; w < m_n.size(); ++w)
+    {
+        m_sum[w] = static_cast<double>(m_n[w]) * x;
+    }
+    m_idx = 0;
+    m_initialized = true;
+}
+
+void MultiWindowMovingAverageFilter::update(double x, double* y)
+{
+    probe().addSamples(1);
+    const std::size_t W = m_n.size();
+
+    if (!m_initialized)
+    {
+        prime(x);
+        for (std::size_t w = 0; w < W; ++w)
+        {
+            y[w] = m_sum[w] / static_cast<double>(m_n[w]);
+        }
+        return;
+    }
+
+    const std::size_t M = m_buf.size();
+    for (std::size_t w = 0; w < W; ++w)
+    {
+        const double old = m_buf[(m_idx + M - m_n[w]) % M];
+        m_sum[w] += x - old;
+        y[w] = m_sum[w] / static_cast<double>(m_n[w]);
+    }
+    m_buf[m_idx] = x;
+    m_idx = (m_idx + 1) % M;
+}
+
+void MultiWindowMovingAverageFilter::process(const double* x, double* const* y, std::size_t n)
+{
+    if (n == 0) return;
+    Instr::BlockTimer timer(probe(), n);
+    const std::size_t W = m_n.size();
+
+    std::size_t i = 0;
+    if (!m_initialized)
+    {
+        prime(x[0]);
+        for (std::size_t w = 0; w < W; ++w)
+        {
+            y[w][0] = m_sum[w] / static_cast<double>(m_n[w]);
+        }
+        i = 1;
+    }
+
+    const std::size_t M = m_buf.size();
+    for (; i < n; ++i)
+    {
+        const double xi = x[i];
+        for (std::size_t w = 0; w < W; ++w)
+        {
+            const double old = m_buf[(m_idx + M - m_n[w]) % M];
+            m_sum[w] += xi - old;
+            y[w][i] = m_sum[w] / static_cast<double>(m_n[w]);
+        }
+        m_buf[m_idx] = xi;
+        m_idx = (m_idx + 1) % M;
+    }
+    probe().addSamples(n);
+}
+
+} // namespace Avg
+} // namespace Filters
@@ -42,8 +42,44 @@ double RunningAverageFilter::update(double x)
         ++m_k;
     }
 
+    probe().addSamples(1);
     return avg;
 }
 
+/*
+Block form (no division in the loop-carried dependency chain):
+
+    avg_k = S_k / k,   S_k = S_{k-1} + x_k,   S_{k-1} = (k-1) * avg_{k-1}
+
+The first pass is a plain prefix sum written into y; the second pass divides
+y[i] by (k+i). That is still one divide per sample, but the divides are
+independent of each other and vectorize. (RunningAverageFilterBank instead
+builds a 1/k table once per block and shares it across channels.) The result
+matches update() to rounding (relative error ~ n * eps).
+*/
+void RunningAverageFilter::process(const double* x, double* y, std::size_t n)
+{
+    if (n == 0) return;
+    Instr::BlockTimer timer(probe(), n);
+
+    const double k0 = static_cast<double>(m_k);
+    double sum = m_prevAvg * (k0 - 1.0);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        sum += x[i];
+        y[i] = sum;
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] /= k0 + static_cast<double>(i);
+    }
+
+    m_prevAvg = y[n - 1];
+    const std::uint64_t room = std::numeric_limits<std::uint64_t>::max() - m_k;
+    m_k += (n < room) ? static_cast<std::uint64_t>(n) : room;
+    probe().addSamples(n);
+}
+
 } // namespace Avg
 } // namespace Filters
\ No newline at end of file
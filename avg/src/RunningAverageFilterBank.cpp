@@ -0,0 +1,85 @@
+#include "RunningAverageFilterBank.hpp"
+
+#include <algorithm>
+#include <limits>
+
+/*
+Multi-channel running mean (see RunningAverageFilter.cpp for the recurrence).
+
+All channels share k, so per frame:
+
+    alpha = (k - 1) / k                  (once)
+    avg_c = alpha * avg_c + (1 - alpha) * x_c   for every channel c
+
+and per block the table recip[i] = 1 / (k + i) is built once and reused by
+every channel's prefix-sum pass.
+*/
+
+namespace Filters
+{
+namespace Avg
+{
+
+static void advance(std::uint64_t& k, std::size_t n)
+{
+    const std::uint64_t room = std::numeric_limits<std::uint64_t>::max() - k;
+    k += (n < room) ? static_cast<std::uint64_t>(n) : room;
+}
+
+void RunningAverageFilterBank::update(const double* x, double* y)
+{
+    const std::size_t channels = m_avg.size();
+    const double alpha = static_cast<double>(m_k - 1) / static_cast<double>(m_k);
+    const double beta = 1.0 - alpha;
+
+    double* avg = m_avg.data();
+    for (std::size_t c = 0; c < channels; ++c)
+    {
+        avg[c] = alpha * avg[c] + beta * x[c];
+        y[c] = avg[c];
+    }
+
+    advance(m_k, 1);
+    probe().addSamples(channels);
+}
+
+void RunningAverageFilterBank::process(const double* const* x, double* const* y, std::size_t n)
+{
+    if (n == 0) return;
+    const std::size_t channels = m_avg.size();
+    Instr::BlockTimer timer(probe(), n * channels);
+
+    const double k0 = static_cast<double>(m_k);
+    m_recip.resize(n);
+    double* recip = m_recip.data();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        recip[i] = 1.0 / (k0 + static_cast<double>(i));
+    }
+
+    for (std::size_t c = 0; c < channels; ++c)
+    {
+        const double* xc = x[c];
+        double* yc = y[c];
+
+        double sum = m_avg[c] * (k0 - 1.0);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            sum += xc[i];
+            yc[i] = sum;
+        }
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            yc[i] *= recip[i];
+        }
+
+        m_avg[c] = yc[n - 1];
+    }
+
+    advance(m_k, n);
+    probe().addSamples(n * channels);
+}
+
+} // namespace Avg
+} // namespace Filters
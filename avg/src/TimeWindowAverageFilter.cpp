@@ -0,0 +1,62 @@
+#include "TimeWindowAverageFilter.hpp"
+
+/*
+Time-window moving average (irregular sampling):
+
+    A(t) = mean{ x_i : t - W < t_i <= t }
+
+Samples are kept in a FIFO ordered by arrival; each update appends (t, x) and
+evicts from the front while the oldest timestamp has left the window, so the
+amortized cost per sample is O(1). With uniform spacing Ts and W = N * Ts this
+reduces to MovingAverageFilter(N) once the window has filled.
+
+The FIFO must stay sorted by time for front-only eviction to be correct, so a
+sample older than the newest buffered one is dropped: it leaves the window
+unchanged and the current average is returned.
+*/
+
+namespace Filters
+{
+namespace Avg
+{
+
+double TimeWindowAverageFilter::updateAt(double t, double x)
+{
+    if (!m_samples.empty() && t < m_samples.back().t)
+    {
+        probe().addSamples(1);
+        return getAverage();
+    }
+
+    const double start = t - m_window;
+    while (!m_samples.empty() && m_samples.front().t <= start)
+    {
+        m_sum -= m_samples.front().x;
+        m_samples.pop_front();
+    }
+
+    // Restart the sum whenever the window empties so rounding error from
+    // long runs of add/subtract does not accumulate across gaps.
+    if (m_samples.empty())
+    {
+        m_sum = 0.0;
+    }
+
+    m_samples.push_back({t, x});
+    m_sum += x;
+    probe().addSamples(1);
+
+    return m_sum / static_cast<double>(m_samples.size());
+}
+
+void TimeWindowAverageFilter::processAt(const double* t, const double* x, double* y, std::size_t n)
+{
+    Instr::BlockTimer timer(probe(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = updateAt(t[i], x[i]);
+    }
+}
+
+} // namespace Avg
+} // namespace Filters
@@ -123,3 +123,24 @@ TEST(MovingAverageFilter, SimulationFromCsv)
     const double stdOut = CsvIO::StdDev(yavg);
     EXPECT_LT(stdOut, stdIn) << "Expected std(avg) < std(raw)";
 }
+
+TEST(MovingAverageFilter, SetStateRebuildsWindowFromSeries)
+{
+    std::mt19937 rng(77);
+    std::normal_distribution<double> dist(0.0, 1.0);
+    std::vector<double> x(300);
+    for (double& v : x) v = dist(rng);
+
+    for (std::size_t count : {1u, 5u, 8u, 9u, 123u})
+    {
+        MovingAverageFilter a(8);
+        for (std::size_t k = 0; k < count; ++k) (void)a.update(x[k]);
+
+        MovingAverageFilter b(8);
+        b.setState(a.getState(), x.data(), count);
+        for (std::size_t k = count; k < x.size(); ++k)
+        {
+            EXPECT_DOUBLE_EQ(b.update(x[k]), a.update(x[k])) << "count=" << count << " k=" << k;
+        }
+    }
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <vector>
+#include <random>
+
+#include "MultiWindowMovingAverageFilter.hpp"
+#include "MovingAverageFilter.hpp"
+#include "CsvData.hpp"
+
+using Filters::Avg::MultiWindowMovingAverageFilter;
+using Filters::Avg::MovingAverageFilter;
+
+TEST(MultiWindowMovingAverageFilter, RejectsInvalidWindows)
+{
+    EXPECT_THROW(MultiWindowMovingAverageFilter({}), std::invalid_argument);
+    EXPECT_THROW(MultiWindowMovingAverageFilter({10, 0}), std::invalid_argument);
+}
+
+TEST(MultiWindowMovingAverageFilter, SharesOneBufferSizedForLargestWindow)
+{
+    MultiWindowMovingAverageFilter f({10, 100, 1000, 10000});
+    EXPECT_EQ(f.getWindowCount(), 4u);
+    EXPECT_EQ(f.getBufferSize(), 10000u);
+    EXPECT_DOUBLE_EQ(f.getAverage(2), 0.0);
+}
+
+TEST(MultiWindowMovingAverageFilter, FirstOutputEqualsFirstSample)
+{
+    MultiWindowMovingAverageFilter f({3, 8, 5});
+    std::vector<double> y(3);
+    f.update(12.34, y.data());
+    for (double v : y) EXPECT_DOUBLE_EQ(v, 12.34);
+}
+
+TEST(MultiWindowMovingAverageFilter, MatchesSeparateMovingAverageFilters)
+{
+    const std::vector<std::size_t> windows = {10, 100, 1000, 7, 1000};
+    MultiWindowMovingAverageFilter multi(windows);
+    std::vector<MovingAverageFilter> ref;
+    for (std::size_t n : windows) ref.emplace_back(n);
+
+    std::mt19937 rng(123);
+    std::normal_distribution<double> dist(0.0, 1.0);
+
+    std::vector<double> y(windows.size());
+    for (int i = 0; i < 5000; ++i)
+    {
+        const double x = dist(rng);
+        multi.update(x, y.data());
+        for (std::size_t w = 0; w < windows.size(); ++w)
+        {
+            EXPECT_DOUBLE_EQ(y[w], ref[w].update(x)) << "w=" << w << " i=" << i;
+            EXPECT_DOUBLE_EQ(multi.getAverage(w), ref[w].getAverage());
+        }
+    }
+}
+
+TEST(MultiWindowMovingAverageFilter, ProcessInBlocksMatchesUpdate)
+{
+    const std::vector<std::size_t> windows = {3, 50, 1};
+    MultiWindowMovingAverageFilter blocks(windows), single(windows);
+
+    std::mt19937 rng(7);
+    std::normal_distribution<double> dist(5.0, 2.0);
+    std::vector<double> x(1000);
+    for (double& v : x) v = dist(rng);
+
+    std::vector<std::vector<double>> out(windows.size(), std::vector<double>(x.size()));
+    std::size_t done = 0;
+    for (std::size_t len : {0u, 1u, 2u, 97u, 400u, 500u})
+    {
+        std::vector<double*> y;
+        for (auto& v : out) y.push_back(v.data() + done);
+        blocks.process(x.data() + done, y.data(), len);
+        done += len;
+    }
+    ASSERT_EQ(done, x.size());
+
+    std::vector<double> frame(windows.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        single.update(x[i], frame.data());
+        for (std::size_t w = 0; w < windows.size(); ++w)
+        {
+            ASSERT_DOUBLE_EQ(out[w][i], frame[w]) << "w=" << w << " i=" << i;
+        }
+    }
+}
+
+TEST(MultiWindowMovingAverageFilter, ResetAndWindowChangeRestartFirstRun)
+{
+    MultiWindowMovingAverageFilter f({2, 4});
+    std::vector<double> y(2);
+    f.update(1.0, y.data());
+    f.update(3.0, y.data());
+
+    f.reset();
+    f.update(7.0, y.data());
+    EXPECT_DOUBLE_EQ(y[0], 7.0);
+    EXPECT_DOUBLE_EQ(y[1], 7.0);
+
+    f.setWindowSizes({5});
+    f.update(2.0, y.data());
+    EXPECT_DOUBLE_EQ(y[0], 2.0);
+    EXPECT_EQ(f.getBufferSize(), 5u);
+}
+
+TEST(MultiWindowMovingAverageFilter, ProcessOnSonarAlt)
+{
+    const std::string csvPath = std::string(DATA_DIR) + "/SonarAlt.csv";
+    if (!std::filesystem::exists(csvPath))
+    {
+        GTEST_SKIP() << "Input CSV not found at '" << csvPath << "'.";
+    }
+
+    CsvSeries s = CsvIO::Load(csvPath, "t", "z");
+    ASSERT_FALSE(s.y.empty()) << "CSV had no rows: " << csvPath;
+
+    const std::vector<std::size_t> windows = {10, 100, 1000};
+    MultiWindowMovingAverageFilter f(windows);
+    std::vector<std::vector<double>> out(windows.size(), std::vector<double>(s.y.size()));
+    std::vector<double*> y;
+    for (auto& v : out) y.push_back(v.data());
+    f.process(s.y.data(), y.data(), s.y.size());
+
+    for (std::size_t w = 0; w < windows.size(); ++w)
+    {
+        MovingAverageFilter ref(windows[w]);
+        std::vector<double> yref(s.y.size());
+        ref.process(s.y.data(), yref.data(), s.y.size());
+        EXPECT_EQ(out[w], yref) << "window " << windows[w];
+    }
+
+    // Longer windows smooth more
+    EXPECT_LT(CsvIO::StdDev(out[1]), CsvIO::StdDev(out[0]));
+    EXPECT_LT(CsvIO::StdDev(out[0]), CsvIO::StdDev(s.y));
+}
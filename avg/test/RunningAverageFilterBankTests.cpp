@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "RunningAverageFilterBank.hpp"
+#include "RunningAverageFilter.hpp"
+#include <vector>
+#include <random>
+#include <cmath>
+
+using Filters::Avg::RunningAverageFilterBank;
+using Filters::Avg::RunningAverageFilter;
+
+TEST(RunningAverageFilterBank, RejectsZeroChannels)
+{
+    EXPECT_THROW(RunningAverageFilterBank(0), std::invalid_argument);
+}
+
+TEST(RunningAverageFilterBank, FrameUpdateMatchesScalarFilters)
+{
+    const std::size_t C = 5;
+    RunningAverageFilterBank bank(C);
+    std::vector<RunningAverageFilter> ref(C);
+
+    std::mt19937 rng(3);
+    std::normal_distribution<double> dist(0.0, 2.0);
+
+    std::vector<double> x(C), y(C);
+    for (int k = 0; k < 200; ++k)
+    {
+        for (std::size_t c = 0; c < C; ++c) x[c] = dist(rng) + static_cast<double>(c);
+        bank.update(x.data(), y.data());
+        for (std::size_t c = 0; c < C; ++c)
+        {
+            EXPECT_DOUBLE_EQ(y[c], ref[c].update(x[c]));
+        }
+    }
+    EXPECT_EQ(bank.getCount(), 200u);
+}
+
+TEST(RunningAverageFilterBank, ProcessMatchesScalarFilters)
+{
+    const std::size_t C = 16;
+    const std::size_t N = 2048;
+
+    std::mt19937 rng(9);
+    std::normal_distribution<double> dist(14.4, 4.0);
+
+    std::vector<std::vector<double>> x(C, std::vector<double>(N));
+    std::vector<std::vector<double>> y(C, std::vector<double>(N));
+    for (auto& col : x) for (double& v : col) v = dist(rng);
+
+    std::vector<const double*> xp(C);
+    std::vector<double*> yp(C);
+
+    RunningAverageFilterBank bank(C);
+    const std::size_t split = 777;
+    for (std::size_t c = 0; c < C; ++c) { xp[c] = x[c].data(); yp[c] = y[c].data(); }
+    bank.process(xp.data(), yp.data(), split);
+    for (std::size_t c = 0; c < C; ++c) { xp[c] += split; yp[c] += split; }
+    bank.process(xp.data(), yp.data(), N - split);
+
+    for (std::size_t c = 0; c < C; ++c)
+    {
+        RunningAverageFilter ref;
+        for (std::size_t k = 0; k < N; ++k)
+        {
+            const double r = ref.update(x[c][k]);
+            EXPECT_NEAR(y[c][k], r, 1e-12 * std::abs(r)) << "c=" << c << " k=" << k;
+        }
+        EXPECT_NEAR(bank.getAverage(c), ref.getAverage(), 1e-12 * std::abs(ref.getAverage()));
+    }
+    EXPECT_EQ(bank.getCount(), N);
+}
+
+TEST(RunningAverageFilterBank, ResetRestoresInitialConditions)
+{
+    RunningAverageFilterBank bank(2);
+    std::vector<double> x = {1.0, 2.0}, y(2);
+    bank.update(x.data(), y.data());
+    bank.reset();
+    EXPECT_EQ(bank.getCount(), 0u);
+    EXPECT_DOUBLE_EQ(bank.getAverage(1), 0.0);
+
+    x = {5.0, 6.0};
+    bank.update(x.data(), y.data());
+    EXPECT_DOUBLE_EQ(y[0], 5.0);
+    EXPECT_DOUBLE_EQ(y[1], 6.0);
+}
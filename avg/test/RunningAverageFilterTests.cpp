@@ -115,4 +115,44 @@ TEST(RunningAverageFilter, VoltageSimulationWithCsv)
     const double sigma = 4.0; // from GetVolt noise
     const double se    = sigma / std::sqrt(static_cast<double>(Nsamples));
     EXPECT_NEAR(Avgsaved.back(), 14.4, 3.0 * se); // close to true mean
-}
\ No newline at end of file
+}
+
+TEST(RunningAverageFilter, ProcessMatchesUpdate)
+{
+    std::mt19937 rng(5);
+    std::normal_distribution<double> dist(14.4, 4.0);
+
+    std::vector<double> x(5000), y(x.size());
+    for (double& v : x) v = dist(rng);
+
+    RunningAverageFilter block, scalar;
+
+    // Split into uneven blocks, with scalar updates in between
+    std::size_t i = 0;
+    for (std::size_t n : {1u, 7u, 256u, 1000u, 3u})
+    {
+        block.process(x.data() + i, y.data() + i, n);
+        i += n;
+        y[i] = block.update(x[i]);
+        ++i;
+    }
+    block.process(x.data() + i, y.data() + i, x.size() - i);
+
+    for (std::size_t k = 0; k < x.size(); ++k)
+    {
+        const double ref = scalar.update(x[k]);
+        EXPECT_NEAR(y[k], ref, 1e-12 * std::abs(ref)) << "k=" << k;
+    }
+    EXPECT_EQ(block.getCount(), scalar.getCount());
+    EXPECT_NEAR(block.getAverage(), scalar.getAverage(), 1e-12 * std::abs(scalar.getAverage()));
+}
+
+TEST(RunningAverageFilter, ProcessInPlace)
+{
+    std::vector<double> x = {10.0, 12.0, 11.0, 13.0, 9.0};
+    RunningAverageFilter f;
+    f.process(x.data(), x.data(), x.size());
+    EXPECT_DOUBLE_EQ(x[0], 10.0);
+    EXPECT_DOUBLE_EQ(x[1], 11.0);
+    EXPECT_NEAR(x[4], 11.0, 1e-12);
+}
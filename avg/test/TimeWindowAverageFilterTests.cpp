@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <vector>
+#include <random>
+#include <cmath>
+
+#include "TimeWindowAverageFilter.hpp"
+#include "MovingAverageFilter.hpp"
+#include "CsvData.hpp"
+
+using Filters::Avg::TimeWindowAverageFilter;
+using Filters::Avg::MovingAverageFilter;
+
+TEST(TimeWindowAverageFilter, FirstOutputEqualsFirstSample)
+{
+    TimeWindowAverageFilter f(5.0);
+    double y = f.updateAt(0.0, 3.5);
+    EXPECT_DOUBLE_EQ(y, 3.5);
+    EXPECT_DOUBLE_EQ(f.getAverage(), 3.5);
+    EXPECT_EQ(f.getCount(), 1u);
+}
+
+TEST(TimeWindowAverageFilter, EvictsSamplesOlderThanWindow)
+{
+    TimeWindowAverageFilter f(3.0);
+    (void)f.updateAt(0.0, 1.0);
+    (void)f.updateAt(1.0, 2.0);
+    (void)f.updateAt(2.0, 3.0);
+    EXPECT_EQ(f.getCount(), 3u);
+
+    // t = 3 pushes t = 0 out of (0, 3]
+    double y = f.updateAt(3.0, 4.0);
+    EXPECT_EQ(f.getCount(), 3u);
+    EXPECT_DOUBLE_EQ(y, 3.0);
+
+    // A gap longer than the window leaves only the new sample
+    y = f.updateAt(10.0, 7.0);
+    EXPECT_EQ(f.getCount(), 1u);
+    EXPECT_DOUBLE_EQ(y, 7.0);
+}
+
+TEST(TimeWindowAverageFilter, UpdateAtIgnoresOutOfOrderTimestamp)
+{
+    TimeWindowAverageFilter f(0.6);
+    (void)f.updateAt(0.0, 0.0);
+    (void)f.updateAt(1.0, 10.0);
+
+    // The stale sample is dropped rather than appended behind newer ones
+    double y = f.updateAt(0.5, 100.0);
+    EXPECT_DOUBLE_EQ(y, 10.0);
+    EXPECT_EQ(f.getCount(), 1u);
+
+    (void)f.updateAt(1.2, 10.0);
+    y = f.updateAt(1.5, 10.0);
+    EXPECT_EQ(f.getCount(), 3u);
+    EXPECT_DOUBLE_EQ(y, 10.0);
+}
+
+TEST(TimeWindowAverageFilter, MatchesMovingAverageOnUniformGridOnceFilled)
+{
+    const std::size_t N = 16;
+    TimeWindowAverageFilter tw(static_cast<double>(N));
+    MovingAverageFilter ma(N);
+
+    std::mt19937 rng(7);
+    std::normal_distribution<double> dist(0.0, 1.0);
+
+    for (int k = 0; k < 500; ++k)
+    {
+        const double x = dist(rng);
+        const double yt = tw.updateAt(static_cast<double>(k), x);
+        const double ym = ma.update(x);
+        if (k >= static_cast<int>(N) - 1)
+        {
+            EXPECT_NEAR(yt, ym, 1e-12) << "k=" << k;
+        }
+    }
+}
+
+TEST(TimeWindowAverageFilter, ProcessAtMatchesUpdateAt)
+{
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<double> jitter(0.05, 0.3);
+    std::normal_distribution<double> dist(2.0, 1.0);
+
+    std::vector<double> t(300), x(300), y(300);
+    double now = 0.0;
+    for (std::size_t i = 0; i < t.size(); ++i)
+    {
+        now += jitter(rng);
+        t[i] = now;
+        x[i] = dist(rng);
+    }
+
+    TimeWindowAverageFilter a(1.5), b(1.5);
+    a.processAt(t.data(), x.data(), y.data(), t.size());
+    for (std::size_t i = 0; i < t.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(y[i], b.updateAt(t[i], x[i]));
+    }
+}
+
+TEST(TimeWindowAverageFilter, SonarAltWithDroppedSamples)
+{
+    const std::string csvPath = std::string(DATA_DIR) + "/SonarAlt.csv";
+    if (!std::filesystem::exists(csvPath))
+    {
+        GTEST_SKIP() << "Input CSV not found at '" << csvPath << "'.";
+    }
+
+    CsvSeries s = CsvIO::Load(csvPath, "t", "z");
+    ASSERT_FALSE(s.y.empty()) << "CSV had no rows: " << csvPath;
+
+    // Drop every third sample to simulate an irregular sensor
+    std::vector<double> t, y;
+    for (std::size_t i = 0; i < s.y.size(); ++i)
+    {
+        if (i % 3 == 2) continue;
+        t.push_back(s.t[i]);
+        y.push_back(s.y[i]);
+    }
+
+    TimeWindowAverageFilter f(10.0);
+    std::vector<double> yavg(y.size());
+    f.processAt(t.data(), y.data(), yavg.data(), y.size());
+
+    EXPECT_LT(CsvIO::StdDev(yavg), CsvIO::StdDev(y)) << "Expected std(avg) < std(raw)";
+}
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "Probe.hpp"
+#include "MovingAverageFilter.hpp"
+#include "RunningAverageFilter.hpp"
+#include "LowPassFilter.hpp"
+#include "SimpleKalmanFilter.hpp"
+
+/*
+Probe overhead benchmark. Built twice (ProbeOverheadBenchOff / ...On) from the
+same sources with FILTERS_INSTRUMENTATION=0/1, so the two outputs can be
+compared directly. Reports the best of several runs in ns per sample for
+per-sample update() calls and for block process() calls.
+*/
+
+using namespace Filters;
+
+namespace
+{
+
+constexpr std::size_t kSamples = 1u << 20;
+constexpr int kRuns = 15;
+
+template <class Fn>
+double bestNsPerSample(Fn&& fn)
+{
+    double best = 1e300;
+    for (int r = 0; r < kRuns; ++r)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        fn();
+        const auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count());
+    }
+    return best / static_cast<double>(kSamples);
+}
+
+// Keeps the optimizer from discarding filter outputs.
+volatile double g_sink;
+
+template <class Filter>
+void run(const char* name, Filter f, const std::vector<double>& x)
+{
+    std::vector<double> y(x.size());
+    const double perSample = bestNsPerSample([&] {
+        double acc = 0.0;
+        for (double v : x) acc += f.update(v);
+        g_sink = acc;
+    });
+    const double block = bestNsPerSample([&] {
+        f.process(x.data(), y.data(), x.size());
+        g_sink = y.back();
+    });
+    std::printf("%-22s update %7.3f ns/sample   process %7.3f ns/sample\n", name, perSample, block);
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937 rng(1);
+    std::normal_distribution<double> noise(0.0, 1.0);
+    std::vector<double> x(kSamples);
+    for (double& v : x) v = 10.0 + noise(rng);
+
+    std::printf("instrumentation: %s\n", Instr::kEnabled ? "on" : "off");
+    run("RunningAverageFilter", Avg::RunningAverageFilter(), x);
+    run("MovingAverageFilter", Avg::MovingAverageFilter(32), x);
+    run("LowPassFilter", LPF::LowPassFilter(0.9), x);
+    run("SimpleKalmanFilter", Kalman::SimpleKalmanFilter(), x);
+    return 0;
+}
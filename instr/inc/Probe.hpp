@@ -0,0 +1,156 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <intrin.h>
+#  define FILTERS_INSTR_HAS_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>
+#  define FILTERS_INSTR_HAS_RDTSC 1
+#endif
+
+namespace Filters
+{
+namespace Instr
+{
+
+// Instrumentation is compiled in only when FILTERS_INSTRUMENTATION is defined
+// (CMake option FILTERS_ENABLE_INSTRUMENTATION). Otherwise every Probe call is
+// an empty inline function and snapshots are all zero.
+#if defined(FILTERS_INSTRUMENTATION) && FILTERS_INSTRUMENTATION
+#  define FILTERS_INSTR_ENABLED 1
+inline constexpr bool kEnabled = true;
+#else
+#  define FILTERS_INSTR_ENABLED 0
+inline constexpr bool kEnabled = false;
+#endif
+
+// Number of log2 buckets in the cycles-per-sample histogram.
+inline constexpr std::size_t kHistogramBuckets = 32;
+
+// Cheap monotonic tick counter: TSC on x86, steady_clock nanoseconds elsewhere.
+inline std::uint64_t readCycles()
+{
+#if defined(FILTERS_INSTR_HAS_RDTSC)
+    return static_cast<std::uint64_t>(__rdtsc());
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+// Point-in-time copy of a Probe's counters.
+struct Snapshot
+{
+    std::uint64_t samples{0};      // samples processed (per-sample and block calls)
+    std::uint64_t blocks{0};       // timed block calls
+    std::uint64_t blockSamples{0}; // samples covered by timed block calls
+    std::uint64_t blockCycles{0};  // total ticks spent in timed block calls
+
+    // hist[b] counts blocks whose ticks-per-sample fell in [2^b, 2^(b+1)); bucket 0 also holds 0.
+    std::array<std::uint64_t, kHistogramBuckets> cyclesPerSample{};
+
+    // Mean ticks per sample over all timed blocks (0 if none).
+    double meanCyclesPerSample() const
+    {
+        return (blockSamples > 0) ? (static_cast<double>(blockCycles) / static_cast<double>(blockSamples)) : 0.0;
+    }
+
+    // Accumulate another snapshot (e.g. to aggregate the channels of a bank).
+    Snapshot& operator+=(const Snapshot& o);
+
+    // Human-readable multi-line dump, optionally prefixed with a name.
+    std::string toText(const std::string& name = "") const;
+
+    // Single JSON object; trailing empty histogram buckets are omitted.
+    std::string toJson(const std::string& name = "") const;
+};
+
+// Per-instance counters. Each filter derives privately from Probe rather than
+// holding one as a member: when instrumentation is disabled the class is empty,
+// all calls compile away, and the empty-base optimization keeps it from adding
+// any storage (a member would still take a padded byte).
+class Probe
+{
+public:
+#if FILTERS_INSTR_ENABLED
+    void addSamples(std::uint64_t n) { m_snap.samples += n; }
+
+    void recordBlock(std::uint64_t n, std::uint64_t cycles)
+    {
+        ++m_snap.blocks;
+        m_snap.blockSamples += n;
+        m_snap.blockCycles += cycles;
+        ++m_snap.cyclesPerSample[bucketOf(n > 0 ? cycles / n : cycles)];
+    }
+
+    Snapshot snapshot() const { return m_snap; }
+
+    void reset() { m_snap = Snapshot{}; }
+#else
+    void addSamples(std::uint64_t) {}
+    void recordBlock(std::uint64_t, std::uint64_t) {}
+    Snapshot snapshot() const { return Snapshot{}; }
+    void reset() {}
+#endif
+
+protected:
+    // Access for the deriving filter.
+    Probe& probe() { return *this; }
+    const Probe& probe() const { return *this; }
+
+private:
+    static std::size_t bucketOf(std::uint64_t v)
+    {
+        std::size_t b = 0;
+        while (v > 1 && b + 1 < kHistogramBuckets)
+        {
+            v >>= 1;
+            ++b;
+        }
+        return b;
+    }
+
+#if FILTERS_INSTR_ENABLED
+    Snapshot m_snap;
+#endif
+};
+
+static_assert(kEnabled || std::is_empty_v<Probe>, "a disabled Probe must be empty");
+
+// RAII timer for one block call: records n samples and the elapsed ticks.
+class BlockTimer
+{
+public:
+    BlockTimer(Probe& probe, std::size_t n)
+        : m_probe(probe)
+        , m_n(n)
+        , m_start(kEnabled ? readCycles() : 0)
+    {
+    }
+
+    ~BlockTimer()
+    {
+        if constexpr (kEnabled)
+        {
+            m_probe.recordBlock(m_n, readCycles() - m_start);
+        }
+    }
+
+    BlockTimer(const BlockTimer&) = delete;
+    BlockTimer& operator=(const BlockTimer&) = delete;
+
+private:
+    Probe&        m_probe;
+    std::size_t   m_n;
+    std::uint64_t m_start;
+};
+
+} // namespace Instr
+} // namespace Filters
@@ -0,0 +1,105 @@
+#include "Probe.hpp"
+
+#include <sstream>
+
+namespace Filters
+{
+namespace Instr
+{
+
+Snapshot& Snapshot::operator+=(const Snapshot& o)
+{
+    samples      += o.samples;
+    blocks       += o.blocks;
+    blockSamples += o.blockSamples;
+    blockCycles  += o.blockCycles;
+    for (std::size_t b = 0; b < kHistogramBuckets; ++b)
+    {
+        cyclesPerSample[b] += o.cyclesPerSample[b];
+    }
+    return *this;
+}
+
+static std::size_t usedBuckets(const Snapshot& s)
+{
+    std::size_t n = kHistogramBuckets;
+    while (n > 0 && s.cyclesPerSample[n - 1] == 0) { --n; }
+    return n;
+}
+
+std::string Snapshot::toText(const std::string& name) const
+{
+    std::ostringstream os;
+    if (!name.empty()) { os << name << ":\n"; }
+    os << "  samples: " << samples << "\n"
+       << "  blocks: " << blocks << "\n"
+       << "  block_samples: " << blockSamples << "\n"
+       << "  block_cycles: " << blockCycles << "\n"
+       << "  mean_cycles_per_sample: " << meanCyclesPerSample() << "\n";
+
+    const std::size_t n = usedBuckets(*this);
+    for (std::size_t b = 0; b < n; ++b)
+    {
+        if (cyclesPerSample[b] == 0) continue;
+        os << "  [" << (b == 0 ? 0ull : (1ull << b)) << ", " << (2ull << b) << "): "
+           << cyclesPerSample[b] << "\n";
+    }
+    return os.str();
+}
+
+// Writes s as a JSON string literal (quotes included).
+static void writeJsonString(std::ostream& os, const std::string& s)
+{
+    static const char* hex = "0123456789abcdef";
+    os << '"';
+    for (const char c : s)
+    {
+        switch (c)
+        {
+        case '"':  os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\n': os << "\\n"; break;
+        case '\r': os << "\\r"; break;
+        case '\t': os << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                os << "\\u00" << hex[(c >> 4) & 0xF] << hex[c & 0xF];
+            }
+            else
+            {
+                os << c;
+            }
+        }
+    }
+    os << '"';
+}
+
+std::string Snapshot::toJson(const std::string& name) const
+{
+    std::ostringstream os;
+    os << "{";
+    if (!name.empty())
+    {
+        os << "\"name\":";
+        writeJsonString(os, name);
+        os << ",";
+    }
+    os << "\"samples\":" << samples
+       << ",\"blocks\":" << blocks
+       << ",\"block_samples\":" << blockSamples
+       << ",\"block_cycles\":" << blockCycles
+       << ",\"cycles_per_sample_log2\":[";
+
+    const std::size_t n = usedBuckets(*this);
+    for (std::size_t b = 0; b < n; ++b)
+    {
+        if (b > 0) os << ",";
+        os << cyclesPerSample[b];
+    }
+    os << "]}";
+    return os.str();
+}
+
+} // namespace Instr
+} // namespace Filters
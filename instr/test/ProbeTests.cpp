@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "Probe.hpp"
+#include "MovingAverageFilter.hpp"
+#include "MultiWindowMovingAverageFilter.hpp"
+#include "RunningAverageFilter.hpp"
+#include "RunningAverageFilterBank.hpp"
+#include "TimeWindowAverageFilter.hpp"
+#include "LowPassFilter.hpp"
+#include "AdaptiveLowPassFilter.hpp"
+#include "SimpleKalmanFilter.hpp"
+
+using namespace Filters;
+
+// Each filter's data members without the Probe. With instrumentation off the
+// filters must have exactly this size, i.e. the Probe adds no storage.
+namespace Layout
+{
+struct RunningAverage { double avg; std::uint64_t k; };
+struct RunningAverageBank { std::vector<double> avg, recip; std::uint64_t k; };
+struct MovingAverage { std::size_t n; std::vector<double> buf; std::size_t idx; double sum; bool init; };
+struct MultiWindow { std::vector<std::size_t> n; std::vector<double> sum, buf; std::size_t idx; bool init; };
+struct TimeWindow { double window; std::deque<std::pair<double, double>> samples; double sum; };
+struct LowPass { double alpha, prevX; bool firstRun; double tau, prevT; bool hasPrevT; };
+struct AdaptiveLowPass { double d[12]; std::uint64_t n; };
+struct Kalman { double a, h, q, r, x, p, prevT; bool hasPrevT; double gate, huber; std::uint64_t rej, down; };
+} // namespace Layout
+
+template <class Filter, class Members>
+constexpr bool SameSizeWhenDisabled()
+{
+    return Instr::kEnabled || sizeof(Filter) == sizeof(Members);
+}
+
+static_assert(SameSizeWhenDisabled<Avg::RunningAverageFilter, Layout::RunningAverage>());
+static_assert(SameSizeWhenDisabled<Avg::RunningAverageFilterBank, Layout::RunningAverageBank>());
+static_assert(SameSizeWhenDisabled<Avg::MovingAverageFilter, Layout::MovingAverage>());
+static_assert(SameSizeWhenDisabled<Avg::MultiWindowMovingAverageFilter, Layout::MultiWindow>());
+static_assert(SameSizeWhenDisabled<Avg::TimeWindowAverageFilter, Layout::TimeWindow>());
+static_assert(SameSizeWhenDisabled<LPF::LowPassFilter, Layout::LowPass>());
+static_assert(SameSizeWhenDisabled<LPF::AdaptiveLowPassFilter, Layout::AdaptiveLowPass>());
+static_assert(SameSizeWhenDisabled<Kalman::SimpleKalmanFilter, Layout::Kalman>());
+
+// Expected counter value: the real count when instrumentation is compiled in, 0 otherwise.
+static std::uint64_t Expected(std::uint64_t n)
+{
+    return Instr::kEnabled ? n : 0;
+}
+
+TEST(Probe, CountsPerSampleUpdates)
+{
+    Avg::RunningAverageFilter f;
+    for (int i = 0; i < 10; ++i) (void)f.update(1.0);
+
+    EXPECT_EQ(f.getStats().samples, Expected(10));
+    EXPECT_EQ(f.getStats().blocks, 0u);
+}
+
+TEST(Probe, BlockCallsRecordSamplesAndHistogram)
+{
+    Avg::MovingAverageFilter f(8);
+    std::vector<double> x(1000, 2.0), y(x.size());
+    f.process(x.data(), y.data(), x.size());
+    f.process(x.data(), y.data(), 500);
+
+    const Instr::Snapshot s = f.getStats();
+    EXPECT_EQ(s.samples, Expected(1500));
+    EXPECT_EQ(s.blocks, Expected(2));
+    EXPECT_EQ(s.blockSamples, Expected(1500));
+
+    std::uint64_t histTotal = 0;
+    for (std::uint64_t c : s.cyclesPerSample) histTotal += c;
+    EXPECT_EQ(histTotal, s.blocks);
+}
+
+TEST(Probe, ResetStatsClearsCountersButNotFilterState)
+{
+    LPF::LowPassFilter f(0.5);
+    (void)f.update(4.0);
+    (void)f.update(0.0);
+    f.resetStats();
+
+    EXPECT_EQ(f.getStats().samples, 0u);
+    EXPECT_DOUBLE_EQ(f.update(0.0), 1.0);
+    EXPECT_EQ(f.getStats().samples, Expected(1));
+}
+
+TEST(Probe, SnapshotsAggregateAcrossFilters)
+{
+    Kalman::SimpleKalmanFilter a, b;
+    std::vector<double> z(64, 14.0), x(z.size());
+    a.process(z.data(), x.data(), z.size());
+    b.process(z.data(), x.data(), 32);
+
+    Instr::Snapshot total = a.getStats();
+    total += b.getStats();
+    EXPECT_EQ(total.samples, Expected(96));
+    EXPECT_EQ(total.blocks, Expected(2));
+}
+
+TEST(Probe, TextAndJsonExport)
+{
+    Instr::Snapshot s;
+    s.samples = 12;
+    s.blocks = 1;
+    s.blockSamples = 12;
+    s.blockCycles = 48;
+    s.cyclesPerSample[2] = 1;
+
+    const std::string json = s.toJson("lpf0");
+    EXPECT_EQ(json, "{\"name\":\"lpf0\",\"samples\":12,\"blocks\":1,\"block_samples\":12,"
+                    "\"block_cycles\":48,\"cycles_per_sample_log2\":[0,0,1]}");
+
+    // Names are escaped
+    EXPECT_EQ(Instr::Snapshot{}.toJson("a\"b\\c\n"),
+              "{\"name\":\"a\\\"b\\\\c\\n\",\"samples\":0,\"blocks\":0,\"block_samples\":0,"
+              "\"block_cycles\":0,\"cycles_per_sample_log2\":[]}");
+
+    const std::string text = s.toText("lpf0");
+    EXPECT_NE(text.find("lpf0:"), std::string::npos);
+    EXPECT_NE(text.find("samples: 12"), std::string::npos);
+    EXPECT_NE(text.find("mean_cycles_per_sample: 4"), std::string::npos);
+    EXPECT_NE(text.find("[4, 8): 1"), std::string::npos);
+}
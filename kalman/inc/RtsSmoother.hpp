@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+
+#include "SimpleKalmanFilter.hpp"
+
+namespace Filters
+{
+namespace Kalman
+{
+
+// Offline Rauch-Tung-Striebel smoother for the SimpleKalmanFilter model.
+//
+// Runs the forward Kalman filter and a backward smoothing pass over a whole
+// series, giving E[x_k | z_1..z_n] instead of the causal E[x_k | z_1..z_k].
+// Model parameters (A, H, Q, R) and the initial estimate/covariance are taken
+// from the prototype filter; its robust (gating/Huber) options are not used.
+class RtsSmoother
+{
+public:
+    explicit RtsSmoother(const SimpleKalmanFilter& model = SimpleKalmanFilter());
+
+    // Sequential forward filter + backward RTS pass. Writes n smoothed means
+    // to xs and, if ps is not null, n smoothed variances to ps.
+    void smooth(const double* z, double* xs, std::size_t n, double* ps = nullptr) const;
+
+    // Same result computed parallel-in-time: both passes are expressed as
+    // associative scans and evaluated as blocked scans on `threads` threads
+    // (0 = hardware_concurrency). Matches smooth() to rounding.
+    void smoothParallel(const double* z, double* xs, std::size_t n, double* ps = nullptr,
+                        unsigned threads = 0) const;
+
+private:
+    double m_a;   // State transition
+    double m_h;   // Measurement model
+    double m_q;   // Process noise covariance
+    double m_r;   // Measurement noise covariance
+    double m_x0;  // Initial state estimate
+    double m_p0;  // Initial error covariance
+};
+
+} // namespace Kalman
+} // namespace Filters
@@ -1,11 +1,16 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
+#include "Probe.hpp"
+
 namespace Filters
 {
 namespace Kalman
 {
 
-class SimpleKalmanFilter
+class SimpleKalmanFilter : private Instr::Probe
 {
 public:
     SimpleKalmanFilter();
@@ -13,7 +18,58 @@ public:
     // Update with a new measurement
     double update(double z);
 
+    // Block version of update over n measurements; writes n estimates to x.
+    // Returns the number of measurements rejected by the innovation gate.
+    std::size_t process(const double* z, double* x, std::size_t n);
+
+    // Update with a timestamped measurement; the process noise Q is treated
+    // as a rate and scaled by the time elapsed since the previous sample.
+    double updateAt(double t, double z);
+
+    // Block version of updateAt over n (t, z) pairs; writes n estimates to x.
+    // Returns the number of measurements rejected by the innovation gate.
+    std::size_t processAt(const double* t, const double* z, double* x, std::size_t n);
+
+    // Model parameters: x_k = A * x_{k-1} + w (var Q), z_k = H * x_k + v (var R)
+    double getStateTransition() const { return m_a; }
+    double getMeasurementModel() const { return m_h; }
+
+    void setProcessNoise(double q) { m_q = q; }
+    double getProcessNoise() const { return m_q; }
+
+    void setMeasurementNoise(double r) { m_r = r; }
+    double getMeasurementNoise() const { return m_r; }
+
+    double getEstimate() const { return m_x; }
+    double getErrorCovariance() const { return m_p; }
+
+    // Overwrite the state estimate and its covariance (e.g. initial conditions).
+    void setEstimate(double x, double p) { m_x = x; m_p = p; }
+
+    // Innovation gate in standard deviations: a measurement whose normalized
+    // innovation |z - H x⁺| / sqrt(S) exceeds the gate is rejected and only the
+    // prediction is kept. 0 disables gating (default).
+    void setInnovationGate(double sigmas) { m_gate = sigmas; }
+    double getInnovationGate() const { return m_gate; }
+
+    // Huber threshold in standard deviations: innovations beyond it inflate R
+    // so the measurement weight falls off as 1/|innovation|. 0 disables (default).
+    void setHuberThreshold(double sigmas) { m_huber = sigmas; }
+    double getHuberThreshold() const { return m_huber; }
+
+    // Measurements rejected by the gate / down-weighted by the Huber rule.
+    std::uint64_t getRejectedCount() const { return m_rejected; }
+    std::uint64_t getDownweightedCount() const { return m_downweighted; }
+    void resetRobustCounts() { m_rejected = 0; m_downweighted = 0; }
+
+    // Instrumentation counters (all zero unless built with FILTERS_ENABLE_INSTRUMENTATION).
+    Instr::Snapshot getStats() const { return probe().snapshot(); }
+    void resetStats() { probe().reset(); }
+
 private:
+    // Measurement update shared by update/updateAt; returns the new estimate.
+    double correct(double xp, double Pp, double z);
+
     double m_a;  // State transition
     double m_h;  // Measurement model
     double m_q;  // Process noise covariance
@@ -21,6 +77,14 @@ private:
 
     double m_x;  // State estimate
     double m_p;  // Error covariance
+
+    double m_prevT{0.0};       // latest updateAt timestamp seen
+    bool   m_hasPrevT{false};  // false until the first updateAt
+
+    double        m_gate{0.0};          // innovation gate (sigmas), 0 = off
+    double        m_huber{0.0};         // Huber threshold (sigmas), 0 = off
+    std::uint64_t m_rejected{0};
+    std::uint64_t m_downweighted{0};
 };
 
 } // namespace Kalman
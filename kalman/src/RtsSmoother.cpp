@@ -0,0 +1,257 @@
+#include "RtsSmoother.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace Filters
+{
+namespace Kalman
+{
+
+/*
+Rauch-Tung-Striebel smoother (scalar model x_k = A x_{k-1} + w, z_k = H x_k + v)
+
+Forward pass: the ordinary Kalman filter, keeping the filtered mean m_k and
+covariance P_k of every sample (x_0 ~ N(x0, P0) is the state before z_1).
+
+Backward pass, from k = n-1 down to 1 (m^s_n = m_n, P^s_n = P_n):
+
+    P⁻_{k+1} = A * P_k * A + Q
+    G_k      = P_k * A / P⁻_{k+1}
+    m^s_k    = m_k + G_k * (m^s_{k+1} - A * m_k)
+    P^s_k    = P_k + G_k * (P^s_{k+1} - P⁻_{k+1}) * G_k
+
+Parallel-in-time form (Särkkä & García-Fernández, 2021): both passes are
+prefix "sums" of an associative operator, so they can be computed by a scan.
+
+Filtering element k describes p(x_k | x_{k-1}, z_k) = N(A_k x_{k-1} + b_k, C_k)
+together with the information that z_k carries about x_{k-1}, N_I(η_k, J_k):
+
+    k = 1 : P⁻ = A P0 A + Q, S = H P⁻ H + R, K = P⁻ H / S
+            (A, b, C, η, J) = (0, A x0 + K (z_1 - H A x0), (1 - K H) P⁻, 0, 0)
+    k > 1 : S = H Q H + R, K = Q H / S
+            (A, b, C, η, J) = ((1 - K H) A, K z_k, (1 - K H) Q, A H z_k / S, A H H A / S)
+
+Combining an earlier element i with a later element j, D = 1 / (1 + C_i J_j):
+
+    A_ij = A_j D A_i             η_ij = A_i D (η_j - J_j b_i) + η_i
+    b_ij = A_j D (b_i + C_i η_j) + b_j
+    C_ij = A_j D C_i A_j + C_j   J_ij = A_i D J_j A_i + J_i
+
+The prefix a_1 ⊗ ... ⊗ a_k has (b, C) = (m_k, P_k).
+
+Smoothing element k describes p(x_k | x_{k+1}, z_1..z_k) = N(E_k x_{k+1} + g_k, L_k):
+
+    k < n : E = G_k, g = m_k - G_k A m_k, L = P_k - G_k A P_k
+    k = n : (E, g, L) = (0, m_n, P_n)
+
+Combining element k (i) with element k+1 (j):
+
+    E_ij = E_i E_j,  g_ij = E_i g_j + g_i,  L_ij = E_i L_j E_i + L_i
+
+The suffix a_k ⊗ ... ⊗ a_n has (g, L) = (m^s_k, P^s_k).
+*/
+
+namespace
+{
+
+struct FilterElement
+{
+    double A, b, C, eta, J;
+};
+
+struct SmoothElement
+{
+    double E, g, L;
+};
+
+FilterElement combine(const FilterElement& i, const FilterElement& j)
+{
+    const double d = 1.0 / (1.0 + i.C * j.J);
+    FilterElement ij;
+    ij.A = j.A * d * i.A;
+    ij.b = j.A * d * (i.b + i.C * j.eta) + j.b;
+    ij.C = j.A * d * i.C * j.A + j.C;
+    ij.eta = i.A * d * (j.eta - j.J * i.b) + i.eta;
+    ij.J = i.A * d * j.J * i.A + i.J;
+    return ij;
+}
+
+SmoothElement combine(const SmoothElement& i, const SmoothElement& j)
+{
+    return {i.E * j.E, i.E * j.g + i.g, i.E * j.L * i.E + i.L};
+}
+
+// Smoother gain; zero when the prediction is certain (P0 = Q = 0).
+double smootherGain(double a, double q, double p)
+{
+    const double Pp = a * p * a + q;
+    return (Pp > 0.0) ? p * a / Pp : 0.0;
+}
+
+// Blocked scan over [0, n) on `threads` threads: each thread reduces its own
+// contiguous chunk, the chunk totals are scanned serially, then each thread
+// re-runs its chunk seeded with the total of all chunks before it.
+// elem(k) builds element k; emit(k, prefix) receives the inclusive prefix.
+// With reverse = true the scan runs from n-1 down to 0 (suffix scan).
+template <class Element, class MakeElement, class Emit>
+void blockedScan(std::size_t n, unsigned threads, bool reverse, MakeElement elem, Emit emit)
+{
+    const std::size_t chunks = std::max<std::size_t>(1, std::min<std::size_t>(threads, n));
+
+    // Chunk c covers scan positions [bounds[c], bounds[c+1]); position s maps
+    // to sample s (forward) or n-1-s (reverse).
+    std::vector<std::size_t> bounds(chunks + 1, 0);
+    for (std::size_t c = 0; c < chunks; ++c)
+    {
+        bounds[c + 1] = bounds[c] + (n - bounds[c]) / (chunks - c);
+    }
+    auto index = [&](std::size_t s) { return reverse ? n - 1 - s : s; };
+    // Forward: prefix ⊗ element; reverse: element ⊗ suffix.
+    auto extend = [&](const Element& acc, const Element& e) {
+        return reverse ? combine(e, acc) : combine(acc, e);
+    };
+
+    auto runChunks = [&](auto body) {
+        std::vector<std::thread> pool;
+        pool.reserve(chunks - 1);
+        for (std::size_t c = 1; c < chunks; ++c)
+        {
+            pool.emplace_back(body, c);
+        }
+        body(0);
+        for (std::thread& t : pool) t.join();
+    };
+
+    // I. Per-chunk totals (the last chunk's total is never needed)
+    std::vector<Element> totals(chunks);
+    if (chunks > 1)
+    {
+        runChunks([&](std::size_t c) {
+            if (c + 1 == chunks) return;
+            Element acc = elem(index(bounds[c]));
+            for (std::size_t s = bounds[c] + 1; s < bounds[c + 1]; ++s)
+            {
+                acc = extend(acc, elem(index(s)));
+            }
+            totals[c] = acc;
+        });
+    }
+
+    // II. Exclusive scan of the chunk totals
+    for (std::size_t c = 1; c + 1 < chunks; ++c)
+    {
+        totals[c] = extend(totals[c - 1], totals[c]);
+    }
+
+    // III. Re-scan every chunk from its carried-in prefix
+    runChunks([&](std::size_t c) {
+        std::size_t s = bounds[c];
+        Element acc = elem(index(s));
+        if (c > 0) acc = extend(totals[c - 1], acc);
+        emit(index(s), acc);
+        for (++s; s < bounds[c + 1]; ++s)
+        {
+            acc = extend(acc, elem(index(s)));
+            emit(index(s), acc);
+        }
+    });
+}
+
+} // namespace
+
+RtsSmoother::RtsSmoother(const SimpleKalmanFilter& model)
+    : m_a(model.getStateTransition())
+    , m_h(model.getMeasurementModel())
+    , m_q(model.getProcessNoise())
+    , m_r(model.getMeasurementNoise())
+    , m_x0(model.getEstimate())
+    , m_p0(model.getErrorCovariance())
+{
+}
+
+void RtsSmoother::smooth(const double* z, double* xs, std::size_t n, double* ps) const
+{
+    if (n == 0) return;
+
+    // Forward pass: filtered means go to xs, covariances to P
+    std::vector<double> P(n);
+    double x = m_x0;
+    double p = m_p0;
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        const double xp = m_a * x;
+        const double Pp = m_a * p * m_a + m_q;
+        const double K = Pp * m_h / (m_h * Pp * m_h + m_r);
+        x = xp + K * (z[k] - m_h * xp);
+        p = (1.0 - K * m_h) * Pp;
+        xs[k] = x;
+        P[k] = p;
+    }
+
+    // Backward pass
+    double ps1 = P[n - 1];
+    if (ps) ps[n - 1] = ps1;
+    for (std::size_t k = n - 1; k-- > 0;)
+    {
+        const double Pp = m_a * P[k] * m_a + m_q;
+        const double G = smootherGain(m_a, m_q, P[k]);
+        xs[k] += G * (xs[k + 1] - m_a * xs[k]);
+        ps1 = P[k] + G * (ps1 - Pp) * G;
+        if (ps) ps[k] = ps1;
+    }
+}
+
+void RtsSmoother::smoothParallel(const double* z, double* xs, std::size_t n, double* ps,
+                                 unsigned threads) const
+{
+    if (n == 0) return;
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Forward scan: filtered means go to xs, covariances to P
+    const double Pp1 = m_a * m_p0 * m_a + m_q;
+    const double S1 = m_h * Pp1 * m_h + m_r;
+    const double K1 = Pp1 * m_h / S1;
+    const double S = m_h * m_q * m_h + m_r;
+    const double K = m_q * m_h / S;
+    const double Ak = (1.0 - K * m_h) * m_a;
+    const double Ck = (1.0 - K * m_h) * m_q;
+    const double Jk = m_a * m_h * m_h * m_a / S;
+
+    std::vector<double> P(n);
+    blockedScan<FilterElement>(
+        n, threads, false,
+        [&](std::size_t k) -> FilterElement {
+            if (k == 0)
+            {
+                const double xp = m_a * m_x0;
+                return {0.0, xp + K1 * (z[0] - m_h * xp), (1.0 - K1 * m_h) * Pp1, 0.0, 0.0};
+            }
+            return {Ak, K * z[k], Ck, m_a * m_h * z[k] / S, Jk};
+        },
+        [&](std::size_t k, const FilterElement& e) {
+            xs[k] = e.b;
+            P[k] = e.C;
+        });
+
+    // Backward scan. Element k reads only m_k and P_k, and each is replaced by
+    // its smoothed value only after being read, so the scan runs in place.
+    blockedScan<SmoothElement>(
+        n, threads, true,
+        [&](std::size_t k) -> SmoothElement {
+            if (k + 1 == n) return {0.0, xs[k], P[k]};
+            const double G = smootherGain(m_a, m_q, P[k]);
+            return {G, xs[k] - G * m_a * xs[k], P[k] - G * m_a * P[k]};
+        },
+        [&](std::size_t k, const SmoothElement& e) {
+            xs[k] = e.g;
+            if (ps) ps[k] = e.L;
+        });
+}
+
+} // namespace Kalman
+} // namespace Filters
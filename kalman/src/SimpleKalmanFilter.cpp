@@ -1,5 +1,7 @@
 #include "SimpleKalmanFilter.hpp"
 
+#include <cmath>
+
 namespace Filters
 {
 namespace Kalman
@@ -21,11 +23,109 @@ double SimpleKalmanFilter::update(double z)
     const double xp = m_a * m_x;
     const double Pp = m_a * m_p * m_a + m_q;
 
+    // II.-IV. Gain, estimate and covariance update
+    return correct(xp, Pp, z);
+}
+
+std::size_t SimpleKalmanFilter::process(const double* z, double* x, std::size_t n)
+{
+    Instr::BlockTimer timer(probe(), n);
+    const std::uint64_t rejected = m_rejected;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = update(z[i]);
+    }
+    return static_cast<std::size_t>(m_rejected - rejected);
+}
+
+/*
+Irregular sampling: with Q given per unit time, the prediction over an
+interval dt uses
+
+    P⁺ = A * P * A + Q * dt
+
+The first timestamped sample (and any non-positive dt) adds no process noise.
+A stale timestamp does not move the clock back, so the next interval is not
+counted twice.
+*/
+double SimpleKalmanFilter::updateAt(double t, double z)
+{
+    double dt = 0.0;
+    if (!m_hasPrevT || t > m_prevT)
+    {
+        dt = m_hasPrevT ? (t - m_prevT) : 0.0;
+        m_prevT = t;
+        m_hasPrevT = true;
+    }
+
+    // I. Predict
+    const double xp = m_a * m_x;
+    const double Pp = m_a * m_p * m_a + m_q * dt;
+
+    // II.-IV. Gain, estimate and covariance update
+    return correct(xp, Pp, z);
+}
+
+std::size_t SimpleKalmanFilter::processAt(const double* t, const double* z, double* x, std::size_t n)
+{
+    Instr::BlockTimer timer(probe(), n);
+    const std::uint64_t rejected = m_rejected;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = updateAt(t[i], z[i]);
+    }
+    return static_cast<std::size_t>(m_rejected - rejected);
+}
+
+/*
+Robust measurement update. With innovation and its predicted variance
+
+    nu = z - H * x⁺
+    S  = H * P⁺ * H + R
+    d  = |nu| / sqrt(S)          (1D Mahalanobis distance)
+
+  - Gating:  d > gate  =>  reject z, keep x = x⁺, P = P⁺
+  - Huber:   d > c     =>  w = c / d,  R' = R / w
+             (the effective measurement weight falls off as 1/|nu|)
+
+Without gate/Huber this is exactly the standard update:
+
+    K = P⁺ * H / (H * P⁺ * H + R)
+    x = x⁺ + K * nu
+    P = P⁺ - K * H * P⁺
+*/
+double SimpleKalmanFilter::correct(double xp, double Pp, double z)
+{
+    probe().addSamples(1);
+
+    const double nu = z - m_h * xp;
+    double r = m_r;
+
+    if (m_gate > 0.0 || m_huber > 0.0)
+    {
+        const double S = m_h * Pp * m_h + m_r;
+        const double d = std::abs(nu) / std::sqrt(S);
+
+        if (m_gate > 0.0 && d > m_gate)
+        {
+            ++m_rejected;
+            m_x = xp;
+            m_p = Pp;
+            return m_x;
+        }
+
+        if (m_huber > 0.0 && d > m_huber)
+        {
+            ++m_downweighted;
+            r = m_r * (d / m_huber);
+        }
+    }
+
     // II. Kalman Gain
-    const double K = Pp * m_h / (m_h * Pp * m_h + m_r);
+    const double K = Pp * m_h / (m_h * Pp * m_h + r);
 
     // III. Update estimate
-    m_x = xp + K * (z - m_h * xp);
+    m_x = xp + K * nu;
 
     // IV. Update error covariance
     m_p = Pp - K * m_h * Pp;
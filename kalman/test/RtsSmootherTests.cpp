@@ -0,0 +1,197 @@
+#include "RtsSmoother.hpp"
+#include "CsvData.hpp"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <random>
+#include <vector>
+#include <cmath>
+
+using namespace Filters::Kalman;
+namespace fs = std::filesystem;
+
+namespace
+{
+
+SimpleKalmanFilter Model(double q, double r, double x0, double p0)
+{
+    SimpleKalmanFilter kf;
+    kf.setProcessNoise(q);
+    kf.setMeasurementNoise(r);
+    kf.setEstimate(x0, p0);
+    return kf;
+}
+
+// Random walk observed in white noise; truth goes to *truth if given.
+std::vector<double> RandomWalk(size_t n, double q, double r, unsigned seed,
+                               std::vector<double>* truth = nullptr)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> w(0.0, std::sqrt(q)), v(0.0, std::sqrt(r));
+    std::vector<double> z(n);
+    double x = 0.0;
+    for (size_t k = 0; k < n; ++k)
+    {
+        x += w(rng);
+        z[k] = x + v(rng);
+        if (truth) truth->push_back(x);
+    }
+    return z;
+}
+
+// Smoothed means are the MAP of the whole chain (A = H = 1): minimise
+// (x_0 - x0)²/P0 + Σ (x_k - x_{k-1})²/Q + Σ (z_k - x_k)²/R over x_0..x_n,
+// a tridiagonal linear system solved here with the Thomas algorithm.
+std::vector<double> ChainMap(const std::vector<double>& z, double q, double r,
+                             double x0, double p0)
+{
+    const size_t n = z.size();
+    std::vector<double> diag(n + 1), rhs(n + 1);
+    for (size_t k = 0; k <= n; ++k)
+    {
+        diag[k] = (k > 0 ? 1.0 / q + 1.0 / r : 1.0 / p0) + (k < n ? 1.0 / q : 0.0);
+        rhs[k] = (k > 0) ? z[k - 1] / r : x0 / p0;
+    }
+    const double off = -1.0 / q;
+    for (size_t k = 1; k <= n; ++k)
+    {
+        const double f = off / diag[k - 1];
+        diag[k] -= f * off;
+        rhs[k] -= f * rhs[k - 1];
+    }
+    std::vector<double> x(n + 1);
+    x[n] = rhs[n] / diag[n];
+    for (size_t k = n; k-- > 0;)
+    {
+        x[k] = (rhs[k] - off * x[k + 1]) / diag[k];
+    }
+    return std::vector<double>(x.begin() + 1, x.end());
+}
+
+double Rmse(const std::vector<double>& a, const std::vector<double>& b)
+{
+    double s = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) s += (a[i] - b[i]) * (a[i] - b[i]);
+    return std::sqrt(s / a.size());
+}
+
+} // namespace
+
+TEST(RtsSmoother, LastSampleEqualsFilteredEstimate)
+{
+    const std::vector<double> z = RandomWalk(200, 0.01, 1.0, 3);
+    SimpleKalmanFilter kf = Model(0.01, 1.0, 0.0, 10.0);
+    const RtsSmoother smoother(kf);
+
+    std::vector<double> xs(z.size()), ps(z.size());
+    smoother.smooth(z.data(), xs.data(), z.size(), ps.data());
+
+    std::vector<double> xf(z.size());
+    kf.process(z.data(), xf.data(), z.size());
+    EXPECT_NEAR(xs.back(), xf.back(), 1e-12);
+    EXPECT_NEAR(ps.back(), kf.getErrorCovariance(), 1e-12);
+
+    // Smoothing never increases the variance
+    SimpleKalmanFilter fwd = Model(0.01, 1.0, 0.0, 10.0);
+    for (size_t k = 0; k < z.size(); ++k)
+    {
+        fwd.update(z[k]);
+        EXPECT_LE(ps[k], fwd.getErrorCovariance() + 1e-12) << "k=" << k;
+    }
+}
+
+TEST(RtsSmoother, MatchesChainMapSolution)
+{
+    const double q = 0.05, r = 2.0, x0 = 1.0, p0 = 3.0;
+    const std::vector<double> z = RandomWalk(500, q, r, 11);
+    const RtsSmoother smoother(Model(q, r, x0, p0));
+
+    std::vector<double> xs(z.size());
+    smoother.smooth(z.data(), xs.data(), z.size());
+
+    const std::vector<double> ref = ChainMap(z, q, r, x0, p0);
+    for (size_t k = 0; k < z.size(); ++k)
+    {
+        EXPECT_NEAR(xs[k], ref[k], 1e-9) << "k=" << k;
+    }
+}
+
+TEST(RtsSmoother, ParallelMatchesSequential)
+{
+    const std::vector<double> z = RandomWalk(10007, 0.02, 0.5, 5);
+    const RtsSmoother smoother(Model(0.02, 0.5, 0.0, 4.0));
+
+    std::vector<double> xs(z.size()), ps(z.size());
+    smoother.smooth(z.data(), xs.data(), z.size(), ps.data());
+
+    for (unsigned threads : {1u, 2u, 3u, 8u, 0u})
+    {
+        std::vector<double> xp(z.size()), pp(z.size());
+        smoother.smoothParallel(z.data(), xp.data(), z.size(), pp.data(), threads);
+        for (size_t k = 0; k < z.size(); ++k)
+        {
+            ASSERT_NEAR(xp[k], xs[k], 1e-9) << "threads=" << threads << " k=" << k;
+            ASSERT_NEAR(pp[k], ps[k], 1e-9) << "threads=" << threads << " k=" << k;
+        }
+    }
+}
+
+TEST(RtsSmoother, ParallelHandlesShortSeries)
+{
+    const std::vector<double> z = {1.0, 2.0, 0.5};
+    const RtsSmoother smoother(Model(0.1, 1.0, 0.0, 1.0));
+
+    std::vector<double> xs(z.size()), xp(z.size());
+    smoother.smooth(z.data(), xs.data(), z.size());
+    smoother.smoothParallel(z.data(), xp.data(), z.size(), nullptr, 8);
+    for (size_t k = 0; k < z.size(); ++k)
+    {
+        EXPECT_NEAR(xp[k], xs[k], 1e-12);
+    }
+
+    // Empty input is a no-op
+    smoother.smooth(nullptr, nullptr, 0);
+    smoother.smoothParallel(nullptr, nullptr, 0);
+}
+
+TEST(RtsSmoother, SmoothedBeatsFilteredOnRandomWalk)
+{
+    const double q = 0.01, r = 1.0;
+    std::vector<double> truth;
+    const std::vector<double> z = RandomWalk(5000, q, r, 7, &truth);
+
+    SimpleKalmanFilter kf = Model(q, r, 0.0, 10.0);
+    std::vector<double> xf(z.size()), xs(z.size());
+    RtsSmoother(kf).smoothParallel(z.data(), xs.data(), z.size());
+    kf.process(z.data(), xf.data(), z.size());
+
+    EXPECT_LT(Rmse(xs, truth), 0.8 * Rmse(xf, truth));
+}
+
+TEST(RtsSmoother, ConstantModelOnVoltage)
+{
+    const std::string csvPath = std::string(DATA_DIR) + "/Voltage.csv";
+    if (!fs::exists(csvPath))
+    {
+        GTEST_SKIP() << "Voltage.csv not found at '" << csvPath << "'.";
+    }
+
+    CsvSeries s = CsvIO::Load(csvPath, "t", "z");
+    ASSERT_FALSE(s.y.empty()) << "CSV had no rows: " << csvPath;
+    const size_t n = s.y.size();
+
+    // Default model has Q = 0: the state is a constant, so every smoothed
+    // sample equals the final filtered estimate.
+    SimpleKalmanFilter kf;
+    std::vector<double> xf(n), xs(n), xp(n);
+    RtsSmoother smoother(kf);
+    smoother.smooth(s.y.data(), xs.data(), n);
+    smoother.smoothParallel(s.y.data(), xp.data(), n, nullptr, 4);
+    kf.process(s.y.data(), xf.data(), n);
+
+    for (size_t k = 0; k < n; ++k)
+    {
+        EXPECT_NEAR(xs[k], xf.back(), 1e-9) << "k=" << k;
+        EXPECT_NEAR(xp[k], xs[k], 1e-9) << "k=" << k;
+    }
+}
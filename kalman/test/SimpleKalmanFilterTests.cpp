@@ -6,6 +6,8 @@
 #include <filesystem>
 #include <cstdlib>  // for getenv
 #include <tuple>
+#include <vector>
+#include <cmath>
 
 using namespace Filters::Kalman;
 namespace fs = std::filesystem;
@@ -89,3 +91,176 @@ TEST(SimpleKalmanFilter, SimulationWithVoltage)
     out.close();
     std::cout << "Kalman filter output written to: " << outFile << "\n";
 }
+
+TEST(SimpleKalmanFilter, UpdateAtWithUnitStepsMatchesUpdate)
+{
+    SimpleKalmanFilter a, b;
+    b.setProcessNoise(0.01);
+
+    // The first timestamped sample adds no process noise, so a starts with
+    // Q = 0 and switches to the per-step Q from the second sample on.
+    for (int i = 0; i < 100; ++i)
+    {
+        const double z = 14.0 + ((i % 7) - 3) * 0.25;
+        const double xa = a.update(z);
+        const double xb = b.updateAt(static_cast<double>(i), z);
+        EXPECT_NEAR(xa, xb, 1e-12) << "i=" << i;
+        a.setProcessNoise(0.01);
+    }
+}
+
+TEST(SimpleKalmanFilter, UpdateAtScalesProcessNoiseWithGap)
+{
+    SimpleKalmanFilter shortGap, longGap;
+    shortGap.setProcessNoise(0.1);
+    longGap.setProcessNoise(0.1);
+
+    (void)shortGap.updateAt(0.0, 10.0);
+    (void)longGap.updateAt(0.0, 10.0);
+
+    // A longer gap means more uncertainty, so the new measurement gets more weight
+    const double xs = shortGap.updateAt(0.1, 20.0);
+    const double xl = longGap.updateAt(50.0, 20.0);
+    EXPECT_GT(xl, xs);
+    EXPECT_GT(longGap.getErrorCovariance(), shortGap.getErrorCovariance());
+}
+
+TEST(SimpleKalmanFilter, UpdateAtIgnoresOutOfOrderTimestamp)
+{
+    SimpleKalmanFilter a, b;
+    a.setProcessNoise(0.5);
+    b.setProcessNoise(0.5);
+
+    // A stale timestamp acts like a repeated one and leaves the clock alone
+    const double ta[] = {0.0, 1.0, 0.5, 1.5};
+    const double tb[] = {0.0, 1.0, 1.0, 1.5};
+    const double z[] = {10.0, 12.0, 11.0, 13.0};
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_DOUBLE_EQ(a.updateAt(ta[i], z[i]), b.updateAt(tb[i], z[i])) << "i=" << i;
+        EXPECT_DOUBLE_EQ(a.getErrorCovariance(), b.getErrorCovariance()) << "i=" << i;
+    }
+}
+
+TEST(SimpleKalmanFilter, ProcessAtMatchesUpdateAt)
+{
+    std::vector<double> t = {0.0, 0.1, 0.35, 0.4, 1.2, 1.25, 2.0};
+    std::vector<double> z = {12.0, 14.5, 13.0, 15.5, 14.0, 13.5, 16.0};
+    std::vector<double> x(t.size());
+
+    SimpleKalmanFilter a, b;
+    a.setProcessNoise(0.5);
+    b.setProcessNoise(0.5);
+    a.processAt(t.data(), z.data(), x.data(), t.size());
+    for (std::size_t i = 0; i < t.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(x[i], b.updateAt(t[i], z[i]));
+    }
+}
+
+// Sonar altitude with a +60 glitch every 37 samples
+static std::vector<double> WithSpikes(const std::vector<double>& y)
+{
+    std::vector<double> out = y;
+    for (size_t i = 20; i < out.size(); i += 37)
+        out[i] += 60.0;
+    return out;
+}
+
+static double Rmse(const std::vector<double>& a, const std::vector<double>& b)
+{
+    double acc = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) acc += (a[i] - b[i]) * (a[i] - b[i]);
+    return std::sqrt(acc / static_cast<double>(a.size()));
+}
+
+static SimpleKalmanFilter SonarKalman(double z0)
+{
+    SimpleKalmanFilter kf;
+    kf.setProcessNoise(1.0);
+    kf.setMeasurementNoise(4.0);
+    kf.setEstimate(z0, 4.0);
+    return kf;
+}
+
+TEST(SimpleKalmanFilter, RobustOptionsDisabledMatchPlainUpdate)
+{
+    SimpleKalmanFilter a, b;
+    b.setInnovationGate(0.0);
+    b.setHuberThreshold(0.0);
+    for (int i = 0; i < 50; ++i)
+    {
+        const double z = 10.0 + ((i * 13) % 11);
+        EXPECT_DOUBLE_EQ(a.update(z), b.update(z));
+    }
+    EXPECT_EQ(b.getRejectedCount(), 0u);
+    EXPECT_EQ(b.getDownweightedCount(), 0u);
+}
+
+TEST(SimpleKalmanFilter, GateRejectsOutlierAndKeepsPrediction)
+{
+    SimpleKalmanFilter kf;
+    kf.setProcessNoise(0.01);
+    kf.setInnovationGate(3.0);
+    for (int i = 0; i < 20; ++i) (void)kf.update(14.0);
+
+    const double before = kf.getEstimate();
+    const double pBefore = kf.getErrorCovariance();
+    EXPECT_DOUBLE_EQ(kf.update(1000.0), before);
+    EXPECT_EQ(kf.getRejectedCount(), 1u);
+    EXPECT_NEAR(kf.getErrorCovariance(), pBefore + 0.01, 1e-12);
+}
+
+TEST(SimpleKalmanFilter, HuberLimitsOutlierInfluence)
+{
+    SimpleKalmanFilter plain, huber;
+    huber.setHuberThreshold(1.5);
+    for (int i = 0; i < 20; ++i)
+    {
+        (void)plain.update(14.0);
+        (void)huber.update(14.0);
+    }
+
+    const double jumpPlain = plain.update(100.0) - 14.0;
+    const double jumpHuber = huber.update(100.0) - 14.0;
+    EXPECT_GT(jumpHuber, 0.0);
+    EXPECT_LT(jumpHuber, 0.5 * jumpPlain);
+    EXPECT_EQ(huber.getDownweightedCount(), 1u);
+}
+
+TEST(SimpleKalmanFilter, RobustBatchOnSpikySonarAlt)
+{
+    const std::string csvPath = std::string(DATA_DIR) + "/SonarAlt.csv";
+    if (!fs::exists(csvPath))
+    {
+        GTEST_SKIP() << "SonarAlt.csv not found at '" << csvPath << "'.";
+    }
+
+    CsvSeries s = CsvIO::Load(csvPath, "t", "z");
+    ASSERT_FALSE(s.y.empty()) << "CSV had no rows: " << csvPath;
+    const std::vector<double> spiky = WithSpikes(s.y);
+    const size_t n = s.y.size();
+    size_t spikes = 0;
+    for (size_t i = 20; i < n; i += 37) ++spikes;
+
+    // Reference: plain filter on the clean series
+    std::vector<double> clean(n), plain(n), gated(n), huber(n);
+    SimpleKalmanFilter kClean = SonarKalman(s.y[0]);
+    kClean.process(s.y.data(), clean.data(), n);
+
+    SimpleKalmanFilter kPlain = SonarKalman(s.y[0]);
+    kPlain.process(spiky.data(), plain.data(), n);
+
+    SimpleKalmanFilter kGated = SonarKalman(s.y[0]);
+    kGated.setInnovationGate(4.0);
+    const size_t rejected = kGated.process(spiky.data(), gated.data(), n);
+
+    SimpleKalmanFilter kHuber = SonarKalman(s.y[0]);
+    kHuber.setHuberThreshold(1.5);
+    kHuber.process(spiky.data(), huber.data(), n);
+
+    EXPECT_GE(rejected, spikes);
+    EXPECT_EQ(rejected, kGated.getRejectedCount());
+    EXPECT_LT(Rmse(gated, clean), 0.25 * Rmse(plain, clean));
+    EXPECT_LT(Rmse(huber, clean), 0.5 * Rmse(plain, clean));
+}
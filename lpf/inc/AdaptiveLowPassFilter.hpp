@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Probe.hpp"
+
+namespace Filters {
+namespace LPF {
+
+// First-order low-pass filter whose alpha is tuned online from running
+// estimates of measurement noise and signal change rate (the steady-state
+// Kalman gain of a random-walk model), so no per-sensor alpha sweep is needed.
+class AdaptiveLowPassFilter : private Instr::Probe
+{
+public:
+    // rate: forgetting factor of the noise estimators, in (0, 1]
+    //       (~1/rate samples of memory).
+    // initialAlpha: alpha used until the estimators have data.
+    explicit AdaptiveLowPassFilter(double rate = 0.001, double initialAlpha = 0.5)
+        : m_initialAlpha(initialAlpha)
+    {
+        setRate(rate);
+        reset();
+    }
+
+    // Feed one sample; returns filtered output
+    double update(double x);
+
+    // Block version of update over n samples; writes n outputs to y.
+    void process(const double* x, double* y, std::size_t n);
+
+    void reset();
+
+    void setRate(double rate)
+    {
+        if (!(rate > 0.0 && rate <= 1.0)) { throw std::invalid_argument("rate must be in (0, 1]"); }
+        m_rate = rate;
+    }
+    double getRate() const { return m_rate; }
+
+    // Clamp range for the adapted alpha (default [0, 0.999]).
+    void setAlphaLimits(double lo, double hi)
+    {
+        if (!(lo >= 0.0 && lo <= hi && hi < 1.0)) { throw std::invalid_argument("alpha limits must satisfy 0 <= lo <= hi < 1"); }
+        m_alphaMin = lo;
+        m_alphaMax = hi;
+    }
+
+    double getAlpha() const { return m_alpha; }
+    double getOutput() const { return m_prevY; }
+
+    // Current estimates of measurement noise variance R and the per-sample
+    // signal change variance Q implied by the adapted gain.
+    double getNoiseVariance() const { return m_r; }
+    double getProcessVariance() const { return m_q; }
+
+    // Instrumentation counters (all zero unless built with FILTERS_ENABLE_INSTRUMENTATION).
+    Instr::Snapshot getStats() const { return probe().snapshot(); }
+    void resetStats() { probe().reset(); }
+
+private:
+    double m_rate{0.001};
+    double m_initialAlpha{0.5};
+    double m_alphaMin{0.0};
+    double m_alphaMax{0.999};
+
+    double m_alpha{0.5};
+    double m_prevY{0.0};
+    double m_prevX{0.0};
+    double m_prevD{0.0};          // previous first difference
+    double m_e2{0.0};             // running E[e_k^2], e_k = x_k - y_{k-1}
+    double m_dd{0.0};             // running E[d_k * d_{k-1}]
+    double m_r{0.0};
+    double m_q{0.0};
+    std::uint64_t m_n{0};         // samples seen since reset
+};
+
+} // namespace LPF
+} // namespace Filters
@@ -1,12 +1,16 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <stdexcept>
+
+#include "Probe.hpp"
 
 namespace Filters {
 namespace LPF {
 
-class LowPassFilter
+class LowPassFilter : private Instr::Probe
 {
 public:
     explicit LowPassFilter(double alpha = 0.5)
@@ -17,15 +21,41 @@ public:
     double update(double x);
     double update(double x, double alpha);
 
+    // Block version of update(x) over n samples; writes n outputs to y.
+    void process(const double* x, double* y, std::size_t n);
+
+    // Feed one timestamped sample; alpha is derived from the elapsed time
+    // since the previous sample and the time constant (see setTimeConstant).
+    double updateAt(double t, double x);
+
+    // Block version of updateAt over n (t, x) pairs; writes n outputs to y.
+    void processAt(const double* t, const double* x, double* y, std::size_t n);
+
     void reset();
 
     void setAlpha(double alpha) { m_alpha = alpha; }
     double getAlpha() const { return m_alpha; }
 
+    // Time constant tau (same unit as t) used by updateAt/processAt.
+    void setTimeConstant(double tau)
+    {
+        if (!(tau > 0.0)) { throw std::invalid_argument("timeConstant must be > 0"); }
+        m_tau = tau;
+    }
+    double getTimeConstant() const { return m_tau; }
+
+    // Instrumentation counters (all zero unless built with FILTERS_ENABLE_INSTRUMENTATION).
+    Instr::Snapshot getStats() const { return probe().snapshot(); }
+    void resetStats() { probe().reset(); }
+
 private:
     double m_alpha;
     double m_prevX;
     bool m_firstRun;
+
+    double m_tau{1.0};        // time constant for the timestamped variants
+    double m_prevT{0.0};      // latest updateAt timestamp seen
+    bool   m_hasPrevT{false}; // false until the first updateAt
 };
 
 } // namespace LPF
@@ -0,0 +1,101 @@
+#include "AdaptiveLowPassFilter.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+/*
+Adaptive alpha from a random-walk-plus-noise model:
+
+    s_k = s_{k-1} + w_k,   var(w) = Q       (signal change)
+    x_k = s_k + v_k,       var(v) = R       (measurement noise)
+
+For this model the steady-state Kalman filter is exactly a one-pole low-pass
+
+    y_k = alpha * y_{k-1} + (1 - alpha) * x_k,   alpha = 1 - K = 1 / (1 + p)
+
+where p = P⁺ / R is the normalized steady-state prior variance. Both
+quantities it depends on are tracked with exponentially weighted means
+(weight max(rate, 1/n), i.e. a plain mean during warm-up):
+
+  - R from first differences d_k = x_k - x_{k-1}, whose lag-1 autocovariance
+    is E[d_k * d_{k-1}] = -R, independent of Q.
+  - P⁺ + R from the innovation e_k = x_k - y_{k-1}, so p = E[e_k^2] / R - 1.
+
+Feeding the gain back this way converges to the optimal steady-state gain
+(the innovation variance of a mistuned filter pulls p towards its fixed
+point), and it is much less noisy than estimating a small Q directly as
+E[d_k^2] - 2R. The implied Q = p^2 R / (1 + p) is reported for inspection.
+Cost per sample: a handful of multiply-adds and one division.
+*/
+
+namespace Filters {
+namespace LPF {
+
+double AdaptiveLowPassFilter::update(double x)
+{
+    probe().addSamples(1);
+
+    if (m_n == 0)
+    {
+        m_prevX = x;
+        m_prevY = x;
+        m_n = 1;
+        return m_prevY;
+    }
+
+    const double d = x - m_prevX;
+    const double e = x - m_prevY;
+    m_prevX = x;
+    ++m_n;
+
+    const double w = std::max(m_rate, 1.0 / static_cast<double>(m_n - 1));
+    m_e2 += w * (e * e - m_e2);
+    if (m_n > 2)
+    {
+        const double wc = std::max(m_rate, 1.0 / static_cast<double>(m_n - 2));
+        m_dd += wc * (d * m_prevD - m_dd);
+
+        m_r = std::max(-m_dd, 0.0);
+        if (m_r > 0.0)
+        {
+            const double p = std::max(m_e2 / m_r - 1.0, 0.0);
+            m_q = p * p * m_r / (1.0 + p);
+            m_alpha = 1.0 / (1.0 + p);
+        }
+        else if (m_e2 > 0.0)
+        {
+            m_q = m_e2;
+            m_alpha = 0.0;               // noise-free: follow the input
+        }
+        m_alpha = std::clamp(m_alpha, m_alphaMin, m_alphaMax);
+    }
+    m_prevD = d;
+
+    m_prevY = m_alpha * m_prevY + (1.0 - m_alpha) * x;
+    return m_prevY;
+}
+
+void AdaptiveLowPassFilter::process(const double* x, double* y, std::size_t n)
+{
+    Instr::BlockTimer timer(probe(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = update(x[i]);
+    }
+}
+
+void AdaptiveLowPassFilter::reset()
+{
+    m_alpha = std::clamp(m_initialAlpha, m_alphaMin, m_alphaMax);
+    m_prevY = 0.0;
+    m_prevX = 0.0;
+    m_prevD = 0.0;
+    m_e2 = 0.0;
+    m_dd = 0.0;
+    m_r = 0.0;
+    m_q = 0.0;
+    m_n = 0;
+}
+
+} // namespace LPF
+} // namespace Filters
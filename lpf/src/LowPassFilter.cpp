@@ -1,5 +1,23 @@
 #include "LowPassFilter.hpp"
 
+#include <cmath>
+
+/*
+Timestamped variant (irregular sampling):
+
+For a continuous first-order system with time constant tau, the exact
+discretization over an interval dt is
+
+    alpha(dt) = exp(-dt / tau)
+    y_k       = alpha(dt) * y_{k-1} + (1 - alpha(dt)) * x_k
+
+so a fixed-rate LowPassFilter with alpha corresponds to tau = -Ts / ln(alpha).
+Non-positive dt (repeated or out-of-order timestamps) is treated as no elapsed
+time, which leaves the output unchanged; the clock only moves forward, so a
+stale timestamp does not make the next interval count twice. The first
+timestamped sample after fixed-rate update() calls only starts the clock.
+*/
+
 namespace Filters {
 namespace LPF {
 
@@ -12,6 +30,7 @@ double LowPassFilter::update(double x)
 
     double xlpf = m_alpha * m_prevX + (1.0 - m_alpha) * x;
     m_prevX = xlpf;
+    probe().addSamples(1);
     return xlpf;
 }
 
@@ -23,14 +42,66 @@ double LowPassFilter::update(double x, double alpha)
         m_firstRun = false;
     }
 
+    m_prevX = alpha * m_prevX + (1.0 - alpha) * x;
+    probe().addSamples(1);
+    return m_prevX;
+}
+
+void LowPassFilter::process(const double* x, double* y, std::size_t n)
+{
+    Instr::BlockTimer timer(probe(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = update(x[i]);
+    }
+}
+
+double LowPassFilter::updateAt(double t, double x)
+{
+    probe().addSamples(1);
+
+    if (m_firstRun)
+    {
+        m_prevX = x;
+        m_prevT = t;
+        m_hasPrevT = true;
+        m_firstRun = false;
+        return m_prevX;
+    }
+
+    if (!m_hasPrevT)
+    {
+        m_prevT = t;
+        m_hasPrevT = true;
+        return m_prevX;
+    }
+
+    const double dt = t - m_prevT;
+    if (!(dt > 0.0))
+    {
+        return m_prevX;
+    }
+    const double alpha = std::exp(-dt / m_tau);
+    m_prevT = t;
+
     m_prevX = alpha * m_prevX + (1.0 - alpha) * x;
     return m_prevX;
 }
 
+void LowPassFilter::processAt(const double* t, const double* x, double* y, std::size_t n)
+{
+    Instr::BlockTimer timer(probe(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = updateAt(t[i], x[i]);
+    }
+}
 
 void LowPassFilter::reset()
 {
     m_prevX = 0.0;
+    m_prevT = 0.0;
+    m_hasPrevT = false;
     m_firstRun = true;
 }
 
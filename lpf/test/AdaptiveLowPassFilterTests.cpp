@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "AdaptiveLowPassFilter.hpp"
+#include "LowPassFilter.hpp"
+#include <vector>
+#include <random>
+#include <cmath>
+#include <filesystem>
+
+#include "CsvData.hpp"
+
+using Filters::LPF::AdaptiveLowPassFilter;
+using Filters::LPF::LowPassFilter;
+
+// Random walk with per-step std sq, observed with noise std sr
+static void RandomWalk(std::size_t n, double sq, double sr, unsigned seed,
+                       std::vector<double>& truth, std::vector<double>& meas)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> w(0.0, sq), v(0.0, sr);
+    truth.resize(n);
+    meas.resize(n);
+    double s = 10.0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        s += w(rng);
+        truth[i] = s;
+        meas[i] = s + v(rng);
+    }
+}
+
+static double Rmse(const std::vector<double>& a, const std::vector<double>& b, std::size_t from)
+{
+    double acc = 0.0;
+    for (std::size_t i = from; i < a.size(); ++i) acc += (a[i] - b[i]) * (a[i] - b[i]);
+    return std::sqrt(acc / static_cast<double>(a.size() - from));
+}
+
+TEST(AdaptiveLowPassFilter, FirstOutputEqualsFirstSample)
+{
+    AdaptiveLowPassFilter f;
+    EXPECT_DOUBLE_EQ(f.update(3.25), 3.25);
+    EXPECT_DOUBLE_EQ(f.getAlpha(), 0.5);
+}
+
+TEST(AdaptiveLowPassFilter, RejectsInvalidSettings)
+{
+    EXPECT_THROW(AdaptiveLowPassFilter(0.0), std::invalid_argument);
+    AdaptiveLowPassFilter f;
+    EXPECT_THROW(f.setAlphaLimits(0.5, 0.2), std::invalid_argument);
+    EXPECT_THROW(f.setAlphaLimits(0.0, 1.0), std::invalid_argument);
+}
+
+TEST(AdaptiveLowPassFilter, EstimatesNoiseAndConvergesToSteadyStateGain)
+{
+    const double sq = 0.3, sr = 1.0;
+    std::vector<double> truth, meas;
+    RandomWalk(200000, sq, sr, 21, truth, meas);
+
+    // The estimates fluctuate with ~1/rate samples of memory, so compare
+    // their averages over the second half of the run.
+    AdaptiveLowPassFilter f(0.001);
+    double r = 0.0, q = 0.0, alpha = 0.0;
+    const std::size_t half = meas.size() / 2;
+    for (std::size_t i = 0; i < meas.size(); ++i)
+    {
+        (void)f.update(meas[i]);
+        if (i < half) continue;
+        r += f.getNoiseVariance();
+        q += f.getProcessVariance();
+        alpha += f.getAlpha();
+    }
+    const double m = static_cast<double>(meas.size() - half);
+
+    EXPECT_NEAR(r / m, sr * sr, 0.05);
+    EXPECT_NEAR(q / m, sq * sq, 0.2 * sq * sq);
+
+    const double rho = (sq * sq) / (sr * sr);
+    const double p = 0.5 * (rho + std::sqrt(rho * rho + 4.0 * rho));
+    EXPECT_NEAR(alpha / m, 1.0 / (1.0 + p), 0.02);
+}
+
+TEST(AdaptiveLowPassFilter, NearBestFixedAlphaWithoutSweep)
+{
+    std::vector<double> truth, meas;
+    RandomWalk(20000, 0.2, 1.0, 5, truth, meas);
+    const std::size_t warmup = 1000;
+
+    double best = 1e300;
+    for (int a = 0; a < 100; ++a)
+    {
+        LowPassFilter lpf(a / 100.0);
+        std::vector<double> y(meas.size());
+        lpf.process(meas.data(), y.data(), meas.size());
+        best = std::min(best, Rmse(y, truth, warmup));
+    }
+
+    AdaptiveLowPassFilter f;
+    std::vector<double> y(meas.size());
+    f.process(meas.data(), y.data(), meas.size());
+
+    EXPECT_LT(Rmse(y, truth, warmup), 1.05 * best);
+}
+
+TEST(AdaptiveLowPassFilter, ProcessMatchesUpdate)
+{
+    std::vector<double> truth, meas;
+    RandomWalk(500, 0.2, 0.5, 8, truth, meas);
+
+    AdaptiveLowPassFilter a(0.05), b(0.05);
+    std::vector<double> y(meas.size());
+    a.process(meas.data(), y.data(), meas.size());
+    for (std::size_t i = 0; i < meas.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(y[i], b.update(meas[i]));
+    }
+}
+
+TEST(AdaptiveLowPassFilter, SmoothsSonarAlt)
+{
+    const std::string csvPath = std::string(DATA_DIR) + "/SonarAlt.csv";
+    if (!std::filesystem::exists(csvPath))
+    {
+        GTEST_SKIP() << "Input CSV not found at '" << csvPath << "'.";
+    }
+
+    CsvSeries s = CsvIO::Load(csvPath, "t", "z");
+    ASSERT_FALSE(s.y.empty()) << "CSV had no usable rows: " << csvPath;
+
+    AdaptiveLowPassFilter f;
+    std::vector<double> yout(s.y.size());
+    f.process(s.y.data(), yout.data(), s.y.size());
+
+    EXPECT_GT(f.getAlpha(), 0.0);
+    EXPECT_LT(f.getAlpha(), 1.0);
+    EXPECT_LT(CsvIO::StdDev(yout), CsvIO::StdDev(s.y)) << "Expected std(lpf) < std(raw)";
+}
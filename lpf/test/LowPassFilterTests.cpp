@@ -3,6 +3,7 @@
 #include <vector>
 #include <fstream>
 #include <filesystem>
+#include <cmath>
 
 #include "CsvData.hpp"          // <-- new helper
 
@@ -94,4 +95,85 @@ TEST(LowPassFilter, SimulateWithSonarAlt)
     const double stdIn  = CsvIO::StdDev(s.y);
     const double stdOut = CsvIO::StdDev(yout);
     EXPECT_LT(stdOut, stdIn) << "Expected std(lpf) < std(raw)";
-}
\ No newline at end of file
+}
+
+TEST(LowPassFilter, UpdateAtMatchesFixedAlphaOnUniformGrid)
+{
+    const double dt = 0.2;
+    const double alpha = 0.7;
+    LowPassFilter fixed(alpha);
+    LowPassFilter timed;
+    timed.setTimeConstant(-dt / std::log(alpha));
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const double x = 14.4 + std::sin(0.1 * i);
+        EXPECT_NEAR(timed.updateAt(i * dt, x), fixed.update(x), 1e-12);
+    }
+}
+
+TEST(LowPassFilter, UpdateAtHandlesGapsAndRepeatedTimestamps)
+{
+    LowPassFilter f;
+    f.setTimeConstant(1.0);
+
+    EXPECT_DOUBLE_EQ(f.updateAt(0.0, 1.0), 1.0);
+
+    // Repeated timestamp: no elapsed time, output unchanged
+    EXPECT_DOUBLE_EQ(f.updateAt(0.0, 5.0), 1.0);
+
+    // Long gap: alpha ~ 0, output jumps to the new sample
+    EXPECT_NEAR(f.updateAt(100.0, 5.0), 5.0, 1e-12);
+
+    EXPECT_THROW(f.setTimeConstant(0.0), std::invalid_argument);
+}
+
+TEST(LowPassFilter, UpdateAtIgnoresOutOfOrderTimestamp)
+{
+    LowPassFilter a, b;
+    a.setTimeConstant(1.0);
+    b.setTimeConstant(1.0);
+
+    (void)a.updateAt(0.0, 0.0);
+    (void)a.updateAt(1.0, 10.0);
+    const double stale = a.updateAt(0.5, 10.0);
+    const double ya = a.updateAt(1.5, 10.0);
+
+    // Same series without the stale sample
+    (void)b.updateAt(0.0, 0.0);
+    const double y1 = b.updateAt(1.0, 10.0);
+    const double yb = b.updateAt(1.5, 10.0);
+
+    EXPECT_DOUBLE_EQ(stale, y1);
+    EXPECT_DOUBLE_EQ(ya, yb);
+}
+
+TEST(LowPassFilter, FirstUpdateAtAfterUpdateStartsClock)
+{
+    LowPassFilter f(0.5);
+    f.setTimeConstant(1.0);
+    (void)f.update(2.0);
+    const double y = f.update(4.0);
+
+    // No filtering across the unknown gap since the last fixed-rate sample
+    EXPECT_DOUBLE_EQ(f.updateAt(1000.0, 10.0), y);
+
+    const double alpha = std::exp(-0.5);
+    EXPECT_NEAR(f.updateAt(1000.5, 10.0), alpha * y + (1.0 - alpha) * 10.0, 1e-12);
+}
+
+TEST(LowPassFilter, ProcessAtMatchesUpdateAt)
+{
+    std::vector<double> t = {0.0, 0.1, 0.35, 0.4, 1.2, 1.25, 2.0};
+    std::vector<double> x = {1.0, 2.0, 0.5, 3.0, 2.5, 1.0, 4.0};
+    std::vector<double> y(t.size());
+
+    LowPassFilter a, b;
+    a.setTimeConstant(0.5);
+    b.setTimeConstant(0.5);
+    a.processAt(t.data(), x.data(), y.data(), t.size());
+    for (std::size_t i = 0; i < t.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(y[i], b.updateAt(t[i], x[i]));
+    }
+}
@@ -0,0 +1,1135 @@
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "MovingAverageFilter.hpp"
+#include "MultiWindowMovingAverageFilter.hpp"
+#include "RunningAverageFilter.hpp"
+#include "RunningAverageFilterBank.hpp"
+#include "TimeWindowAverageFilter.hpp"
+#include "LowPassFilter.hpp"
+#include "AdaptiveLowPassFilter.hpp"
+#include "SimpleKalmanFilter.hpp"
+#include "RtsSmoother.hpp"
+#include "ParameterSweep.hpp"
+
+/*
+Python bindings for the filter classes, written against the CPython C API.
+
+Block calls take float64 C-contiguous arrays (anything exporting the buffer
+protocol, normally NumPy) and work on their buffers directly: inputs are never
+copied or converted, so any other dtype/layout raises TypeError, and outputs
+are written into `out=` when given, otherwise into a new numpy.empty array.
+The GIL is released while a block runs, so independent filter instances
+(e.g. one per channel) can be processed in parallel Python threads.
+*/
+
+namespace
+{
+
+using namespace Filters;
+
+// Thrown once a Python exception has been set; turned into a NULL return.
+struct PyError
+{
+};
+
+[[noreturn]] void fail(PyObject* type, const std::string& msg)
+{
+    PyErr_SetString(type, msg.c_str());
+    throw PyError{};
+}
+
+// Owned reference.
+class Ref
+{
+public:
+    explicit Ref(PyObject* o = nullptr) : m_o(o) {}
+    ~Ref() { Py_XDECREF(m_o); }
+    Ref(const Ref&) = delete;
+    Ref& operator=(const Ref&) = delete;
+
+    PyObject* get() const { return m_o; }
+    PyObject* release()
+    {
+        PyObject* o = m_o;
+        m_o = nullptr;
+        return o;
+    }
+
+private:
+    PyObject* m_o;
+};
+
+PyObject* check(PyObject* o)
+{
+    if (!o) throw PyError{};
+    return o;
+}
+
+// Calls fn() and maps C++ exceptions to Python ones.
+template <class Fn>
+PyObject* guarded(Fn&& fn)
+{
+    try
+    {
+        return fn();
+    }
+    catch (const PyError&)
+    {
+    }
+    catch (const std::invalid_argument& e)
+    {
+        PyErr_SetString(PyExc_ValueError, e.what());
+    }
+    catch (const std::out_of_range& e)
+    {
+        PyErr_SetString(PyExc_IndexError, e.what());
+    }
+    catch (const std::bad_alloc&)
+    {
+        PyErr_NoMemory();
+    }
+    catch (const std::exception& e)
+    {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+    }
+    return nullptr;
+}
+
+// Runs fn with the GIL released; exceptions are rethrown once it is re-acquired.
+template <class Fn>
+void withoutGil(Fn&& fn)
+{
+    std::exception_ptr err;
+    Py_BEGIN_ALLOW_THREADS
+    try
+    {
+        fn();
+    }
+    catch (...)
+    {
+        err = std::current_exception();
+    }
+    Py_END_ALLOW_THREADS
+    if (err) std::rethrow_exception(err);
+}
+
+// --- Buffers ----------------------------------------------------------------
+
+bool isFloat64(const char* format)
+{
+    if (!format) return false;
+    if (*format == '@' || *format == '=') ++format;
+#if PY_LITTLE_ENDIAN
+    if (*format == '<') ++format;
+#else
+    if (*format == '>') ++format;
+#endif
+    return std::strcmp(format, "d") == 0;
+}
+
+// View of a float64 C-contiguous buffer, held for the duration of a call.
+// Never copies: anything else raises TypeError.
+class Buffer
+{
+public:
+    Buffer(PyObject* obj, const char* name, bool writable)
+    {
+        if (PyObject_GetBuffer(obj, &m_view, PyBUF_STRIDES | PyBUF_FORMAT) != 0)
+        {
+            PyErr_Clear();
+            fail(PyExc_TypeError, std::string(name) + " must be a float64 C-contiguous array");
+        }
+        if (!isFloat64(m_view.format) || m_view.itemsize != sizeof(double) ||
+            !PyBuffer_IsContiguous(&m_view, 'C'))
+        {
+            reject(PyExc_TypeError, std::string(name) + " must be a float64 C-contiguous array");
+        }
+        if (writable && m_view.readonly)
+        {
+            reject(PyExc_ValueError, std::string(name) + " must be writable");
+        }
+        m_held = true;
+    }
+
+    ~Buffer()
+    {
+        if (m_held) PyBuffer_Release(&m_view);
+    }
+
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+
+    int ndim() const { return m_view.ndim; }
+    std::size_t shape(int i) const { return static_cast<std::size_t>(m_view.shape[i]); }
+    double* data() const { return static_cast<double*>(m_view.buf); }
+
+    void requireDims(int ndim, const char* name) const
+    {
+        if (m_view.ndim != ndim)
+        {
+            fail(PyExc_ValueError, std::string(name) + " must be " + std::to_string(ndim) + "-dimensional");
+        }
+    }
+
+private:
+    // The destructor does not run when the constructor throws, so the
+    // export taken above has to be released here.
+    [[noreturn]] void reject(PyObject* type, const std::string& msg)
+    {
+        PyBuffer_Release(&m_view);
+        fail(type, msg);
+    }
+
+    Py_buffer m_view{};
+    bool      m_held{false};
+};
+
+PyObject* g_numpyEmpty = nullptr;  // numpy.empty
+
+// Returns a new reference to `out` if it has the given shape (checked again
+// when its buffer is taken), or to a new numpy.empty(shape) if `out` is None.
+PyObject* outputFor(PyObject* out, const std::vector<std::size_t>& shape)
+{
+    if (out == Py_None)
+    {
+        Ref dims(check(PyTuple_New(static_cast<Py_ssize_t>(shape.size()))));
+        for (std::size_t i = 0; i < shape.size(); ++i)
+        {
+            PyTuple_SET_ITEM(dims.get(), i, check(PyLong_FromSize_t(shape[i])));
+        }
+        return check(PyObject_CallOneArg(g_numpyEmpty, dims.get()));
+    }
+
+    Buffer y(out, "out", true);
+    bool same = y.ndim() == static_cast<int>(shape.size());
+    for (std::size_t i = 0; same && i < shape.size(); ++i)
+    {
+        same = y.shape(static_cast<int>(i)) == shape[i];
+    }
+    if (!same) fail(PyExc_ValueError, "out has the wrong shape");
+    Py_INCREF(out);
+    return out;
+}
+
+// y = fn(x, y, n) over a 1-D block with the GIL released.
+template <class Fn>
+PyObject* runBlock(PyObject* xo, PyObject* outo, const char* xname, Fn&& fn)
+{
+    Buffer x(xo, xname, false);
+    x.requireDims(1, xname);
+    const std::size_t n = x.shape(0);
+
+    Ref out(outputFor(outo, {n}));
+    Buffer y(out.get(), "out", true);
+    withoutGil([&] { fn(x.data(), y.data(), n); });
+    return out.release();
+}
+
+// y = fn(t, x, y, n) over 1-D blocks of equal length with the GIL released.
+template <class Fn>
+PyObject* runBlockAt(PyObject* to, PyObject* xo, PyObject* outo, const char* xname, Fn&& fn)
+{
+    Buffer t(to, "t", false);
+    Buffer x(xo, xname, false);
+    t.requireDims(1, "t");
+    x.requireDims(1, xname);
+    const std::size_t n = x.shape(0);
+    if (t.shape(0) != n) fail(PyExc_ValueError, std::string("t and ") + xname + " must have the same length");
+
+    Ref out(outputFor(outo, {n}));
+    Buffer y(out.get(), "out", true);
+    withoutGil([&] { fn(t.data(), x.data(), y.data(), n); });
+    return out.release();
+}
+
+// --- Scalar conversions -----------------------------------------------------
+
+template <class A>
+A fromPy(PyObject* o);
+
+template <>
+PyObject* fromPy<PyObject*>(PyObject* o)
+{
+    return o;
+}
+
+template <>
+double fromPy<double>(PyObject* o)
+{
+    const double v = PyFloat_AsDouble(o);
+    if (v == -1.0 && PyErr_Occurred()) throw PyError{};
+    return v;
+}
+
+template <>
+std::size_t fromPy<std::size_t>(PyObject* o)
+{
+    const std::size_t v = PyLong_AsSize_t(o);
+    if (v == static_cast<std::size_t>(-1) && PyErr_Occurred()) throw PyError{};
+    return v;
+}
+
+PyObject* toPy(double v) { return PyFloat_FromDouble(v); }
+PyObject* toPy(unsigned long v) { return PyLong_FromUnsignedLong(v); }
+
+template <class T>
+std::vector<T> listOf(PyObject* seq, const char* name)
+{
+    Ref fast(PySequence_Fast(seq, name));
+    check(fast.get());
+    const Py_ssize_t n = PySequence_Fast_GET_SIZE(fast.get());
+    std::vector<T> v(static_cast<std::size_t>(n));
+    for (Py_ssize_t i = 0; i < n; ++i)
+    {
+        v[static_cast<std::size_t>(i)] = fromPy<T>(PySequence_Fast_GET_ITEM(fast.get(), i));
+    }
+    return v;
+}
+
+// --- Generic object and method wrappers -------------------------------------
+
+template <class T>
+struct Object
+{
+    PyObject_HEAD
+    T* impl;
+};
+
+template <class T>
+T& self(PyObject* o)
+{
+    T* impl = reinterpret_cast<Object<T>*>(o)->impl;
+    if (!impl) fail(PyExc_RuntimeError, "object is not initialized");
+    return *impl;
+}
+
+template <class T>
+void dealloc(PyObject* o)
+{
+    PyTypeObject* type = Py_TYPE(o);
+    delete reinterpret_cast<Object<T>*>(o)->impl;
+    type->tp_free(o);
+    Py_DECREF(type);
+}
+
+// (Re)constructs the wrapped object from a factory; used by tp_init.
+template <class T, class Make>
+int construct(PyObject* o, Make&& make)
+{
+    PyObject* r = guarded([&]() -> PyObject* {
+        T* impl = make();
+        delete reinterpret_cast<Object<T>*>(o)->impl;
+        reinterpret_cast<Object<T>*>(o)->impl = impl;
+        Py_RETURN_NONE;
+    });
+    if (!r) return -1;
+    Py_DECREF(r);
+    return 0;
+}
+
+// Binds a member function (or a free function taking T& first) with scalar
+// arguments and result as a positional-only METH_FASTCALL method.
+template <auto F>
+struct Bind;
+
+template <class T, class R, class... A, class Fn, std::size_t... I>
+PyObject* invoke(Fn&& fn, PyObject* const* args, Py_ssize_t nargs, const char* name,
+                 std::index_sequence<I...>)
+{
+    if (nargs != static_cast<Py_ssize_t>(sizeof...(A)))
+    {
+        fail(PyExc_TypeError, std::string(name) + "() takes " + std::to_string(sizeof...(A)) +
+                                  " positional argument(s)");
+    }
+    std::tuple<std::decay_t<A>...> values{fromPy<std::decay_t<A>>(args[I])...};
+    if constexpr (std::is_void_v<R>)
+    {
+        fn(std::get<I>(values)...);
+        Py_RETURN_NONE;
+    }
+    else
+    {
+        return check(toPy(fn(std::get<I>(values)...)));
+    }
+}
+
+template <class T, class R, class... A, R (T::*F)(A...)>
+struct Bind<F>
+{
+    using Type = T;
+    static PyObject* call(PyObject* o, PyObject* const* args, Py_ssize_t nargs)
+    {
+        return guarded([&] {
+            T& t = self<T>(o);
+            return invoke<T, R, A...>([&](auto... a) { return (t.*F)(a...); }, args, nargs, "method",
+                                      std::index_sequence_for<A...>{});
+        });
+    }
+};
+
+template <class T, class R, class... A, R (T::*F)(A...) const>
+struct Bind<F>
+{
+    using Type = T;
+    static PyObject* call(PyObject* o, PyObject* const* args, Py_ssize_t nargs)
+    {
+        return guarded([&] {
+            const T& t = self<T>(o);
+            return invoke<T, R, A...>([&](auto... a) { return (t.*F)(a...); }, args, nargs, "method",
+                                      std::index_sequence_for<A...>{});
+        });
+    }
+};
+
+template <class T, class R, class... A, R (*F)(T&, A...)>
+struct Bind<F>
+{
+    using Type = T;
+    static PyObject* call(PyObject* o, PyObject* const* args, Py_ssize_t nargs)
+    {
+        return guarded([&] {
+            T& t = self<T>(o);
+            return invoke<T, R, A...>([&](auto... a) { return F(t, a...); }, args, nargs, "method",
+                                      std::index_sequence_for<A...>{});
+        });
+    }
+};
+
+template <auto F>
+PyMethodDef method(const char* name, const char* doc = nullptr)
+{
+    return {name, reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&Bind<F>::call)),
+            METH_FASTCALL, doc};
+}
+
+// process(x, out=None) for any class with process(const double*, double*, n).
+template <class T>
+PyObject* process(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    return guarded([&] {
+        static const char* kw[] = {"x", "out", nullptr};
+        PyObject* x;
+        PyObject* out = Py_None;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:process", const_cast<char**>(kw), &x, &out))
+        {
+            throw PyError{};
+        }
+        T& t = self<T>(o);
+        return runBlock(x, out, "x", [&](const double* xp, double* yp, std::size_t n) { t.process(xp, yp, n); });
+    });
+}
+
+// processAt(t, x, out=None) for any class with processAt(t, x, y, n).
+template <class T>
+PyObject* processAt(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    return guarded([&] {
+        static const char* kw[] = {"t", "x", "out", nullptr};
+        PyObject* tt;
+        PyObject* x;
+        PyObject* out = Py_None;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|O:processAt", const_cast<char**>(kw), &tt, &x, &out))
+        {
+            throw PyError{};
+        }
+        T& t = self<T>(o);
+        return runBlockAt(tt, x, out, "x", [&](const double* tp, const double* xp, double* yp, std::size_t n) {
+            t.processAt(tp, xp, yp, n);
+        });
+    });
+}
+
+template <class T>
+PyMethodDef processMethod()
+{
+    return {"process", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&process<T>)),
+            METH_VARARGS | METH_KEYWORDS, "process(x, out=None) -> array"};
+}
+
+template <class T>
+PyMethodDef processAtMethod()
+{
+    return {"processAt", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&processAt<T>)),
+            METH_VARARGS | METH_KEYWORDS, "processAt(t, x, out=None) -> array"};
+}
+
+constexpr PyMethodDef kEnd = {nullptr, nullptr, 0, nullptr};
+
+// Creates the heap type filters.<name> and adds it to the module.
+// PyModule_AddObjectRef is 3.10+; this keeps the module building on 3.9.
+void addObject(PyObject* module, const char* name, PyObject* obj)
+{
+    Py_INCREF(obj);
+    if (PyModule_AddObject(module, name, obj) != 0)  // steals only on success
+    {
+        Py_DECREF(obj);
+        throw PyError{};
+    }
+}
+
+template <class T>
+PyTypeObject* addType(PyObject* module, const char* qualifiedName, initproc init, PyMethodDef* methods,
+                      const char* doc)
+{
+    PyType_Slot slots[] = {
+        {Py_tp_new, reinterpret_cast<void*>(PyType_GenericNew)},
+        {Py_tp_init, reinterpret_cast<void*>(init)},
+        {Py_tp_dealloc, reinterpret_cast<void*>(&dealloc<T>)},
+        {Py_tp_methods, methods},
+        {Py_tp_doc, const_cast<char*>(doc)},
+        {0, nullptr},
+    };
+    PyType_Spec spec = {qualifiedName, sizeof(Object<T>), 0, Py_TPFLAGS_DEFAULT, slots};
+    PyObject* type = check(PyType_FromSpec(&spec));
+    try
+    {
+        addObject(module, std::strrchr(qualifiedName, '.') + 1, type);
+    }
+    catch (const PyError&)
+    {
+        Py_DECREF(type);
+        throw;
+    }
+    Py_DECREF(type);  // the module keeps it alive
+    return reinterpret_cast<PyTypeObject*>(type);
+}
+
+// --- Averages ---------------------------------------------------------------
+
+using Avg::MovingAverageFilter;
+using Avg::MultiWindowMovingAverageFilter;
+using Avg::RunningAverageFilter;
+using Avg::RunningAverageFilterBank;
+using Avg::TimeWindowAverageFilter;
+
+int initRunningAverage(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    static const char* kw[] = {nullptr};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":RunningAverageFilter", const_cast<char**>(kw))) return -1;
+    return construct<RunningAverageFilter>(o, [] { return new RunningAverageFilter(); });
+}
+
+PyMethodDef g_runningAverageMethods[] = {
+    method<&RunningAverageFilter::update>("update"),
+    processMethod<RunningAverageFilter>(),
+    method<&RunningAverageFilter::reset>("reset"),
+    method<&RunningAverageFilter::getAverage>("getAverage"),
+    method<&RunningAverageFilter::getCount>("getCount"),
+    kEnd,
+};
+
+int initRunningAverageBank(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    static const char* kw[] = {"channels", nullptr};
+    Py_ssize_t channels;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "n:RunningAverageFilterBank", const_cast<char**>(kw), &channels))
+    {
+        return -1;
+    }
+    return construct<RunningAverageFilterBank>(o, [&] {
+        if (channels < 0) fail(PyExc_ValueError, "channels must be >= 0");
+        return new RunningAverageFilterBank(static_cast<std::size_t>(channels));
+    });
+}
+
+// x has shape (channels, n): one contiguous row per channel.
+PyObject* bankProcess(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    return guarded([&] {
+        static const char* kw[] = {"x", "out", nullptr};
+        PyObject* xo;
+        PyObject* outo = Py_None;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:process", const_cast<char**>(kw), &xo, &outo))
+        {
+            throw PyError{};
+        }
+        RunningAverageFilterBank& f = self<RunningAverageFilterBank>(o);
+        Buffer x(xo, "x", false);
+        x.requireDims(2, "x");
+        const std::size_t channels = f.getChannels();
+        if (x.shape(0) != channels) fail(PyExc_ValueError, "x must have shape (channels, n)");
+        const std::size_t n = x.shape(1);
+
+        Ref out(outputFor(outo, {channels, n}));
+        Buffer y(out.get(), "out", true);
+        std::vector<const double*> xp(channels);
+        std::vector<double*> yp(channels);
+        for (std::size_t c = 0; c < channels; ++c)
+        {
+            xp[c] = x.data() + c * n;
+            yp[c] = y.data() + c * n;
+        }
+        withoutGil([&] { f.process(xp.data(), yp.data(), n); });
+        return out.release();
+    });
+}
+
+double bankAverage(RunningAverageFilterBank& f, std::size_t channel)
+{
+    if (channel >= f.getChannels()) throw std::out_of_range("channel out of range");
+    return f.getAverage(channel);
+}
+
+PyMethodDef g_runningAverageBankMethods[] = {
+    {"process", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&bankProcess)),
+     METH_VARARGS | METH_KEYWORDS, "process(x, out=None) -> array; x has shape (channels, n)"},
+    method<&RunningAverageFilterBank::reset>("reset"),
+    method<&RunningAverageFilterBank::getChannels>("getChannels"),
+    method<&bankAverage>("getAverage"),
+    method<&RunningAverageFilterBank::getCount>("getCount"),
+    kEnd,
+};
+
+int initMovingAverage(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    static const char* kw[] = {"windowSize", nullptr};
+    Py_ssize_t windowSize = 100;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|n:MovingAverageFilter", const_cast<char**>(kw), &windowSize))
+    {
+        return -1;
+    }
+    return construct<MovingAverageFilter>(o, [&] {
+        if (windowSize < 0) fail(PyExc_ValueError, "windowSize must be > 0");
+        return new MovingAverageFilter(static_cast<std::size_t>(windowSize));
+    });
+}
+
+PyMethodDef g_movingAverageMethods[] = {
+    method<&MovingAverageFilter::update>("update"),
+    processMethod<MovingAverageFilter>(),
+    method<&MovingAverageFilter::reset>("reset"),
+    method<&MovingAverageFilter::setWindowSize>("setWindowSize"),
+    method<&MovingAverageFilter::getWindowSize>("getWindowSize"),
+    method<&MovingAverageFilter::getAverage>("getAverage"),
+    kEnd,
+};
+
+int initMultiWindow(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    static const char* kw[] = {"windowSizes", nullptr};
+    PyObject* sizes;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:MultiWindowMovingAverageFilter", const_cast<char**>(kw), &sizes))
+    {
+        return -1;
+    }
+    return construct<MultiWindowMovingAverageFilter>(o, [&] {
+        return new MultiWindowMovingAverageFilter(listOf<std::size_t>(sizes, "windowSizes must be a sequence"));
+    });
+}
+
+// update(x) -> array with one average per window
+PyObject* multiWindowUpdate(PyObject* o, PyObject* const* args, Py_ssize_t nargs)
+{
+    return guarded([&] {
+        MultiWindowMovingAverageFilter& f = self<MultiWindowMovingAverageFilter>(o);
+        if (nargs != 1) fail(PyExc_TypeError, "update() takes 1 positional argument");
+        const double x = fromPy<double>(args[0]);
+        Ref out(outputFor(Py_None, {f.getWindowCount()}));
+        Buffer y(out.get(), "out", true);
+        f.update(x, y.data());
+        return out.release();
+    });
+}
+
+// process(x, out=None) -> array of shape (windows, n)
+PyObject* multiWindowProcess(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    return guarded([&] {
+        static const char* kw[] = {"x", "out", nullptr};
+        PyObject* xo;
+        PyObject* outo = Py_None;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:process", const_cast<char**>(kw), &xo, &outo))
+        {
+            throw PyError{};
+        }
+        MultiWindowMovingAverageFilter& f = self<MultiWindowMovingAverageFilter>(o);
+        Buffer x(xo, "x", false);
+        x.requireDims(1, "x");
+        const std::size_t n = x.shape(0);
+        const std::size_t W = f.getWindowCount();
+
+        Ref out(outputFor(outo, {W, n}));
+        Buffer y(out.get(), "out", true);
+        std::vector<double*> yp(W);
+        for (std::size_t w = 0; w < W; ++w) yp[w] = y.data() + w * n;
+        withoutGil([&] { f.process(x.data(), yp.data(), n); });
+        return out.release();
+    });
+}
+
+void multiWindowSetSizes(MultiWindowMovingAverageFilter& f, PyObject* sizes)
+{
+    f.setWindowSizes(listOf<std::size_t>(sizes, "windowSizes must be a sequence"));
+}
+
+PyObject* multiWindowGetSizes(PyObject* o, PyObject* const*, Py_ssize_t)
+{
+    return guarded([&] {
+        const std::vector<std::size_t>& sizes = self<MultiWindowMovingAverageFilter>(o).getWindowSizes();
+        Ref list(check(PyList_New(static_cast<Py_ssize_t>(sizes.size()))));
+        for (std::size_t w = 0; w < sizes.size(); ++w)
+        {
+            PyList_SET_ITEM(list.get(), static_cast<Py_ssize_t>(w), check(PyLong_FromSize_t(sizes[w])));
+        }
+        return list.release();
+    });
+}
+
+double multiWindowAverage(MultiWindowMovingAverageFilter& f, std::size_t w)
+{
+    if (w >= f.getWindowCount()) throw std::out_of_range("window index out of range");
+    return f.getAverage(w);
+}
+
+PyMethodDef g_multiWindowMethods[] = {
+    {"update", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&multiWindowUpdate)), METH_FASTCALL,
+     "update(x) -> array, one average per window"},
+    {"process", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&multiWindowProcess)),
+     METH_VARARGS | METH_KEYWORDS, "process(x, out=None) -> array of shape (windows, n)"},
+    method<&MultiWindowMovingAverageFilter::reset>("reset"),
+    method<&multiWindowSetSizes>("setWindowSizes"),
+    {"getWindowSizes", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&multiWindowGetSizes)),
+     METH_FASTCALL, "getWindowSizes() -> list[int]"},
+    method<&MultiWindowMovingAverageFilter::getWindowCount>("getWindowCount"),
+    method<&MultiWindowMovingAverageFilter::getBufferSize>("getBufferSize"),
+    method<&multiWindowAverage>("getAverage"),
+    kEnd,
+};
+
+int initTimeWindowAverage(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    static const char* kw[] = {"window", nullptr};
+    double window = 1.0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|d:TimeWindowAverageFilter", const_cast<char**>(kw), &window))
+    {
+        return -1;
+    }
+    return construct<TimeWindowAverageFilter>(o, [&] { return new TimeWindowAverageFilter(window); });
+}
+
+PyMethodDef g_timeWindowAverageMethods[] = {
+    method<&TimeWindowAverageFilter::updateAt>("updateAt"),
+    processAtMethod<TimeWindowAverageFilter>(),
+    method<&TimeWindowAverageFilter::reset>("reset"),
+    method<&TimeWindowAverageFilter::setWindow>("setWindow"),
+    method<&TimeWindowAverageFilter::getWindow>("getWindow"),
+    method<&TimeWindowAverageFilter::getCount>("getCount"),
+    method<&TimeWindowAverageFilter::getAverage>("getAverage"),
+    kEnd,
+};
+
+// --- Low-pass ---------------------------------------------------------------
+
+using LPF::AdaptiveLowPassFilter;
+using LPF::LowPassFilter;
+
+int initLowPass(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    static const char* kw[] = {"alpha", nullptr};
+    double alpha = 0.5;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|d:LowPassFilter", const_cast<char**>(kw), &alpha)) return -1;
+    return construct<LowPassFilter>(o, [&] { return new LowPassFilter(alpha); });
+}
+
+// update(x) or update(x, alpha)
+PyObject* lowPassUpdate(PyObject* o, PyObject* const* args, Py_ssize_t nargs)
+{
+    return guarded([&] {
+        LowPassFilter& f = self<LowPassFilter>(o);
+        if (nargs == 1) return check(toPy(f.update(fromPy<double>(args[0]))));
+        if (nargs == 2) return check(toPy(f.update(fromPy<double>(args[0]), fromPy<double>(args[1]))));
+        fail(PyExc_TypeError, "update() takes 1 or 2 positional arguments");
+    });
+}
+
+PyMethodDef g_lowPassMethods[] = {
+    {"update", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&lowPassUpdate)), METH_FASTCALL,
+     "update(x[, alpha]) -> float"},
+    method<&LowPassFilter::updateAt>("updateAt"),
+    processMethod<LowPassFilter>(),
+    processAtMethod<LowPassFilter>(),
+    method<&LowPassFilter::reset>("reset"),
+    method<&LowPassFilter::setAlpha>("setAlpha"),
+    method<&LowPassFilter::getAlpha>("getAlpha"),
+    method<&LowPassFilter::setTimeConstant>("setTimeConstant"),
+    method<&LowPassFilter::getTimeConstant>("getTimeConstant"),
+    kEnd,
+};
+
+int initAdaptiveLowPass(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    static const char* kw[] = {"rate", "initialAlpha", nullptr};
+    double rate = 0.001;
+    double initialAlpha = 0.5;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|dd:AdaptiveLowPassFilter", const_cast<char**>(kw), &rate,
+                                     &initialAlpha))
+    {
+        return -1;
+    }
+    return construct<AdaptiveLowPassFilter>(o, [&] { return new AdaptiveLowPassFilter(rate, initialAlpha); });
+}
+
+PyMethodDef g_adaptiveLowPassMethods[] = {
+    method<&AdaptiveLowPassFilter::update>("update"),
+    processMethod<AdaptiveLowPassFilter>(),
+    method<&AdaptiveLowPassFilter::reset>("reset"),
+    method<&AdaptiveLowPassFilter::setRate>("setRate"),
+    method<&AdaptiveLowPassFilter::getRate>("getRate"),
+    method<&AdaptiveLowPassFilter::setAlphaLimits>("setAlphaLimits"),
+    method<&AdaptiveLowPassFilter::getAlpha>("getAlpha"),
+    method<&AdaptiveLowPassFilter::getOutput>("getOutput"),
+    method<&AdaptiveLowPassFilter::getNoiseVariance>("getNoiseVariance"),
+    method<&AdaptiveLowPassFilter::getProcessVariance>("getProcessVariance"),
+    kEnd,
+};
+
+// --- Kalman -----------------------------------------------------------------
+
+using Kalman::SimpleKalmanFilter;
+
+PyTypeObject* g_kalmanType = nullptr;
+
+int initKalman(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    static const char* kw[] = {nullptr};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":SimpleKalmanFilter", const_cast<char**>(kw))) return -1;
+    return construct<SimpleKalmanFilter>(o, [] { return new SimpleKalmanFilter(); });
+}
+
+// The C++ block calls return the rejected count; from Python that is
+// getRejectedCount(), and the call returns the estimates like the others.
+PyObject* kalmanProcessPy(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    return guarded([&] {
+        static const char* kw[] = {"z", "out", nullptr};
+        PyObject* z;
+        PyObject* out = Py_None;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:process", const_cast<char**>(kw), &z, &out))
+        {
+            throw PyError{};
+        }
+        SimpleKalmanFilter& f = self<SimpleKalmanFilter>(o);
+        return runBlock(z, out, "z", [&](const double* zp, double* xp, std::size_t n) { (void)f.process(zp, xp, n); });
+    });
+}
+
+PyObject* kalmanProcessAtPy(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    return guarded([&] {
+        static const char* kw[] = {"t", "z", "out", nullptr};
+        PyObject* t;
+        PyObject* z;
+        PyObject* out = Py_None;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|O:processAt", const_cast<char**>(kw), &t, &z, &out))
+        {
+            throw PyError{};
+        }
+        SimpleKalmanFilter& f = self<SimpleKalmanFilter>(o);
+        return runBlockAt(t, z, out, "z", [&](const double* tp, const double* zp, double* xp, std::size_t n) {
+            (void)f.processAt(tp, zp, xp, n);
+        });
+    });
+}
+
+PyMethodDef g_kalmanMethods[] = {
+    method<&SimpleKalmanFilter::update>("update"),
+    method<&SimpleKalmanFilter::updateAt>("updateAt"),
+    {"process", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&kalmanProcessPy)),
+     METH_VARARGS | METH_KEYWORDS, "process(z, out=None) -> array"},
+    {"processAt", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&kalmanProcessAtPy)),
+     METH_VARARGS | METH_KEYWORDS, "processAt(t, z, out=None) -> array"},
+    method<&SimpleKalmanFilter::getStateTransition>("getStateTransition"),
+    method<&SimpleKalmanFilter::getMeasurementModel>("getMeasurementModel"),
+    method<&SimpleKalmanFilter::setProcessNoise>("setProcessNoise"),
+    method<&SimpleKalmanFilter::getProcessNoise>("getProcessNoise"),
+    method<&SimpleKalmanFilter::setMeasurementNoise>("setMeasurementNoise"),
+    method<&SimpleKalmanFilter::getMeasurementNoise>("getMeasurementNoise"),
+    method<&SimpleKalmanFilter::setEstimate>("setEstimate"),
+    method<&SimpleKalmanFilter::getEstimate>("getEstimate"),
+    method<&SimpleKalmanFilter::getErrorCovariance>("getErrorCovariance"),
+    method<&SimpleKalmanFilter::setInnovationGate>("setInnovationGate"),
+    method<&SimpleKalmanFilter::getInnovationGate>("getInnovationGate"),
+    method<&SimpleKalmanFilter::setHuberThreshold>("setHuberThreshold"),
+    method<&SimpleKalmanFilter::getHuberThreshold>("getHuberThreshold"),
+    method<&SimpleKalmanFilter::getRejectedCount>("getRejectedCount"),
+    method<&SimpleKalmanFilter::getDownweightedCount>("getDownweightedCount"),
+    method<&SimpleKalmanFilter::resetRobustCounts>("resetRobustCounts"),
+    kEnd,
+};
+
+using Kalman::RtsSmoother;
+
+int initRtsSmoother(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    static const char* kw[] = {"model", nullptr};
+    PyObject* model = Py_None;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O:RtsSmoother", const_cast<char**>(kw), &model)) return -1;
+    return construct<RtsSmoother>(o, [&] {
+        if (model == Py_None) return new RtsSmoother();
+        if (!PyObject_TypeCheck(model, g_kalmanType)) fail(PyExc_TypeError, "model must be a SimpleKalmanFilter");
+        return new RtsSmoother(self<SimpleKalmanFilter>(model));
+    });
+}
+
+// smooth(z, out=None, variance=None, threads=...) for both variants; the
+// smoothed variances go to `variance` when it is given.
+template <bool Parallel>
+PyObject* rtsSmooth(PyObject* o, PyObject* args, PyObject* kwargs)
+{
+    return guarded([&] {
+        // The serial variant takes no `threads`, so its list stops one short.
+        static const char* kw[] = {"z", "out", "variance", Parallel ? "threads" : nullptr, nullptr};
+        PyObject* zo;
+        PyObject* outo = Py_None;
+        PyObject* varo = Py_None;
+        unsigned threads = 0;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, Parallel ? "O|OOI:smoothParallel" : "O|OO:smooth",
+                                         const_cast<char**>(kw), &zo, &outo, &varo, &threads))
+        {
+            throw PyError{};
+        }
+        const RtsSmoother& f = self<RtsSmoother>(o);
+        Buffer z(zo, "z", false);
+        z.requireDims(1, "z");
+        const std::size_t n = z.shape(0);
+
+        Ref out(outputFor(outo, {n}));
+        Buffer xs(out.get(), "out", true);
+        double* ps = nullptr;
+        std::unique_ptr<Buffer> var;
+        if (varo != Py_None)
+        {
+            Ref shaped(outputFor(varo, {n}));  // only checks the shape
+            var = std::make_unique<Buffer>(varo, "variance", true);
+            ps = var->data();
+        }
+        withoutGil([&] {
+            if constexpr (Parallel)
+                f.smoothParallel(z.data(), xs.data(), n, ps, threads);
+            else
+                f.smooth(z.data(), xs.data(), n, ps);
+        });
+        return out.release();
+    });
+}
+
+PyMethodDef g_rtsSmootherMethods[] = {
+    {"smooth", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&rtsSmooth<false>)),
+     METH_VARARGS | METH_KEYWORDS, "smooth(z, out=None, variance=None) -> array"},
+    {"smoothParallel", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&rtsSmooth<true>)),
+     METH_VARARGS | METH_KEYWORDS, "smoothParallel(z, out=None, variance=None, threads=0) -> array"},
+    kEnd,
+};
+
+// --- Parameter sweep --------------------------------------------------------
+
+PyTypeObject* g_sweepResultType = nullptr;
+
+PyStructSequence_Field g_sweepResultFields[] = {
+    {"param", "candidate value (alpha, window size or R)"},
+    {"rmse", "sqrt(mean((y - ref)^2))"},
+    {"residualStdDev", "std(y - ref)"},
+    {"lag", "shift in samples minimizing the squared error"},
+    {nullptr, nullptr},
+};
+
+PyStructSequence_Desc g_sweepResultDesc = {"filters.SweepResult", "Metrics of one sweep candidate",
+                                           g_sweepResultFields, 4};
+
+PyObject* toList(const std::vector<Sweep::SweepResult>& results)
+{
+    Ref list(check(PyList_New(static_cast<Py_ssize_t>(results.size()))));
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        Ref r(check(PyStructSequence_New(g_sweepResultType)));
+        PyStructSequence_SetItem(r.get(), 0, check(PyFloat_FromDouble(results[i].param)));
+        PyStructSequence_SetItem(r.get(), 1, check(PyFloat_FromDouble(results[i].rmse)));
+        PyStructSequence_SetItem(r.get(), 2, check(PyFloat_FromDouble(results[i].residualStdDev)));
+        PyStructSequence_SetItem(r.get(), 3, check(PyLong_FromSize_t(results[i].lag)));
+        PyList_SET_ITEM(list.get(), static_cast<Py_ssize_t>(i), r.release());
+    }
+    return list.release();
+}
+
+// Runs a sweep over x with the common keyword options; run(x, n, opt) does
+// the actual call with the GIL released.
+template <class Run>
+PyObject* sweep(PyObject* xo, PyObject* reference, Py_ssize_t skip, Py_ssize_t maxLag, unsigned threads, Run&& run)
+{
+    Buffer x(xo, "x", false);
+    x.requireDims(1, "x");
+    const std::size_t n = x.shape(0);
+    if (skip < 0 || maxLag < 0) fail(PyExc_ValueError, "skip and maxLag must be >= 0");
+
+    Sweep::SweepOptions opt;
+    opt.skip = static_cast<std::size_t>(skip);
+    opt.maxLag = static_cast<std::size_t>(maxLag);
+    opt.threads = threads;
+
+    std::vector<Sweep::SweepResult> results;
+    if (reference != Py_None)
+    {
+        Buffer ref(reference, "reference", false);
+        ref.requireDims(1, "reference");
+        if (ref.shape(0) != n) fail(PyExc_ValueError, "reference must have the same length as x");
+        opt.reference = ref.data();
+        withoutGil([&] { results = run(x.data(), n, opt); });
+    }
+    else
+    {
+        withoutGil([&] { results = run(x.data(), n, opt); });
+    }
+    return toList(results);
+}
+
+PyObject* sweepLowPassAlpha(PyObject*, PyObject* args, PyObject* kwargs)
+{
+    return guarded([&] {
+        static const char* kw[] = {"x", "alphas", "reference", "skip", "maxLag", "threads", nullptr};
+        PyObject* x;
+        PyObject* alphaSeq;
+        PyObject* reference = Py_None;
+        Py_ssize_t skip = 0, maxLag = 16;
+        unsigned threads = 1;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|OnnI:sweepLowPassAlpha", const_cast<char**>(kw), &x,
+                                         &alphaSeq, &reference, &skip, &maxLag, &threads))
+        {
+            throw PyError{};
+        }
+        const std::vector<double> alphas = listOf<double>(alphaSeq, "alphas must be a sequence");
+        return sweep(x, reference, skip, maxLag, threads, [&](const double* xp, std::size_t n, const auto& opt) {
+            return Sweep::ParameterSweep::lowPassAlpha(xp, n, alphas, opt);
+        });
+    });
+}
+
+PyObject* sweepMovingAverageWindow(PyObject*, PyObject* args, PyObject* kwargs)
+{
+    return guarded([&] {
+        static const char* kw[] = {"x", "windows", "reference", "skip", "maxLag", "threads", nullptr};
+        PyObject* x;
+        PyObject* windowSeq;
+        PyObject* reference = Py_None;
+        Py_ssize_t skip = 0, maxLag = 16;
+        unsigned threads = 1;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|OnnI:sweepMovingAverageWindow", const_cast<char**>(kw),
+                                         &x, &windowSeq, &reference, &skip, &maxLag, &threads))
+        {
+            throw PyError{};
+        }
+        const std::vector<std::size_t> windows = listOf<std::size_t>(windowSeq, "windows must be a sequence");
+        return sweep(x, reference, skip, maxLag, threads, [&](const double* xp, std::size_t n, const auto& opt) {
+            return Sweep::ParameterSweep::movingAverageWindow(xp, n, windows, opt);
+        });
+    });
+}
+
+PyObject* sweepKalmanMeasurementNoise(PyObject*, PyObject* args, PyObject* kwargs)
+{
+    return guarded([&] {
+        static const char* kw[] = {"x", "rs", "prototype", "reference", "skip", "maxLag", "threads", nullptr};
+        PyObject* x;
+        PyObject* rSeq;
+        PyObject* protoObj = Py_None;
+        PyObject* reference = Py_None;
+        Py_ssize_t skip = 0, maxLag = 16;
+        unsigned threads = 1;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|OOnnI:sweepKalmanMeasurementNoise",
+                                         const_cast<char**>(kw), &x, &rSeq, &protoObj, &reference, &skip, &maxLag,
+                                         &threads))
+        {
+            throw PyError{};
+        }
+        const std::vector<double> rs = listOf<double>(rSeq, "rs must be a sequence");
+        SimpleKalmanFilter prototype;
+        if (protoObj != Py_None)
+        {
+            if (!PyObject_TypeCheck(protoObj, g_kalmanType)) fail(PyExc_TypeError, "prototype must be a SimpleKalmanFilter");
+            prototype = self<SimpleKalmanFilter>(protoObj);
+        }
+        return sweep(x, reference, skip, maxLag, threads, [&](const double* xp, std::size_t n, const auto& opt) {
+            return Sweep::ParameterSweep::kalmanMeasurementNoise(xp, n, rs, prototype, opt);
+        });
+    });
+}
+
+PyMethodDef g_moduleMethods[] = {
+    {"sweepLowPassAlpha", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&sweepLowPassAlpha)),
+     METH_VARARGS | METH_KEYWORDS,
+     "sweepLowPassAlpha(x, alphas, reference=None, skip=0, maxLag=16, threads=1) -> list[SweepResult]"},
+    {"sweepMovingAverageWindow",
+     reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&sweepMovingAverageWindow)),
+     METH_VARARGS | METH_KEYWORDS,
+     "sweepMovingAverageWindow(x, windows, reference=None, skip=0, maxLag=16, threads=1) -> list[SweepResult]"},
+    {"sweepKalmanMeasurementNoise",
+     reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(&sweepKalmanMeasurementNoise)),
+     METH_VARARGS | METH_KEYWORDS,
+     "sweepKalmanMeasurementNoise(x, rs, prototype=None, reference=None, skip=0, maxLag=16, threads=1)"
+     " -> list[SweepResult]"},
+    kEnd,
+};
+
+PyModuleDef g_module = {
+    PyModuleDef_HEAD_INIT,
+    "filters",
+    "Scalar filters (running/moving average, low-pass, Kalman) with zero-copy NumPy block processing",
+    -1,
+    g_moduleMethods,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+};
+
+} // namespace
+
+PyMODINIT_FUNC PyInit_filters()
+{
+    Ref module(PyModule_Create(&g_module));
+    if (!module.get()) return nullptr;
+
+    PyObject* ok = guarded([&] {
+        Ref numpy(check(PyImport_ImportModule("numpy")));
+        g_numpyEmpty = check(PyObject_GetAttrString(numpy.get(), "empty"));
+
+        PyObject* m = module.get();
+        addType<RunningAverageFilter>(m, "filters.RunningAverageFilter", initRunningAverage,
+                                      g_runningAverageMethods, "RunningAverageFilter()");
+        addType<RunningAverageFilterBank>(m, "filters.RunningAverageFilterBank", initRunningAverageBank,
+                                          g_runningAverageBankMethods, "RunningAverageFilterBank(channels)");
+        addType<MovingAverageFilter>(m, "filters.MovingAverageFilter", initMovingAverage, g_movingAverageMethods,
+                                     "MovingAverageFilter(windowSize=100)");
+        addType<MultiWindowMovingAverageFilter>(m, "filters.MultiWindowMovingAverageFilter", initMultiWindow,
+                                                g_multiWindowMethods, "MultiWindowMovingAverageFilter(windowSizes)");
+        addType<TimeWindowAverageFilter>(m, "filters.TimeWindowAverageFilter", initTimeWindowAverage,
+                                         g_timeWindowAverageMethods, "TimeWindowAverageFilter(window=1.0)");
+        addType<LowPassFilter>(m, "filters.LowPassFilter", initLowPass, g_lowPassMethods, "LowPassFilter(alpha=0.5)");
+        addType<AdaptiveLowPassFilter>(m, "filters.AdaptiveLowPassFilter", initAdaptiveLowPass,
+                                       g_adaptiveLowPassMethods,
+                                       "AdaptiveLowPassFilter(rate=0.001, initialAlpha=0.5)");
+        g_kalmanType = addType<SimpleKalmanFilter>(m, "filters.SimpleKalmanFilter", initKalman, g_kalmanMethods,
+                                                   "SimpleKalmanFilter()");
+        addType<RtsSmoother>(m, "filters.RtsSmoother", initRtsSmoother, g_rtsSmootherMethods,
+                             "RtsSmoother(model=None); model parameters come from a SimpleKalmanFilter");
+
+        g_sweepResultType = PyStructSequence_NewType(&g_sweepResultDesc);
+        if (!g_sweepResultType) throw PyError{};
+        addObject(m, "SweepResult", reinterpret_cast<PyObject*>(g_sweepResultType));
+        Py_RETURN_NONE;
+    });
+    if (!ok) return nullptr;
+    Py_DECREF(ok);
+    return module.release();
+}
@@ -0,0 +1,255 @@
+"""Tests for the 'filters' extension module (run by ctest as PythonFilters)."""
+
+import sys
+import threading
+import time
+import unittest
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+
+import filters
+
+
+def noisy(n, seed=1):
+    rng = np.random.default_rng(seed)
+    return 10.0 + np.cumsum(rng.normal(0.0, 0.1, n)) + rng.normal(0.0, 1.0, n)
+
+
+def per_sample(make, x):
+    """Reference: the scalar update() of the same C++ class, one call per sample."""
+    f = make()
+    return np.array([f.update(v) for v in x])
+
+
+class ProcessMatchesUpdate(unittest.TestCase):
+    def check(self, make):
+        x = noisy(2000)
+        np.testing.assert_allclose(make().process(x), per_sample(make, x), rtol=1e-12, atol=1e-12)
+
+    def test_running_average(self):
+        self.check(filters.RunningAverageFilter)
+
+    def test_moving_average(self):
+        self.check(lambda: filters.MovingAverageFilter(16))
+
+    def test_low_pass(self):
+        self.check(lambda: filters.LowPassFilter(0.8))
+
+    def test_adaptive_low_pass(self):
+        self.check(filters.AdaptiveLowPassFilter)
+
+    def test_kalman(self):
+        def make():
+            kf = filters.SimpleKalmanFilter()
+            kf.setProcessNoise(0.01)
+            kf.setInnovationGate(3.0)
+            return kf
+
+        self.check(make)
+
+    def test_low_pass_reference(self):
+        x = noisy(500)
+        y = np.empty_like(x)
+        prev = x[0]
+        for i, v in enumerate(x):
+            prev = 0.7 * prev + 0.3 * v
+            y[i] = prev
+        np.testing.assert_allclose(filters.LowPassFilter(0.7).process(x), y, rtol=1e-12)
+
+    def test_process_at(self):
+        t = np.cumsum(np.random.default_rng(2).uniform(0.5, 1.5, 1000))
+        x = noisy(1000)
+        a, b = filters.LowPassFilter(), filters.LowPassFilter()
+        a.setTimeConstant(3.0)
+        b.setTimeConstant(3.0)
+        np.testing.assert_array_equal(a.processAt(t, x), [b.updateAt(ti, xi) for ti, xi in zip(t, x)])
+
+        w, v = filters.TimeWindowAverageFilter(5.0), filters.TimeWindowAverageFilter(5.0)
+        np.testing.assert_array_equal(w.processAt(t, x), [v.updateAt(ti, xi) for ti, xi in zip(t, x)])
+
+    def test_bank(self):
+        x = np.ascontiguousarray(noisy(3000).reshape(3, 1000))
+        bank = filters.RunningAverageFilterBank(3)
+        y = bank.process(x)
+        self.assertEqual(y.shape, (3, 1000))
+        for c in range(3):
+            np.testing.assert_allclose(y[c], per_sample(filters.RunningAverageFilter, x[c]), rtol=1e-12)
+            self.assertAlmostEqual(bank.getAverage(c), y[c, -1], places=12)
+        with self.assertRaises(IndexError):
+            bank.getAverage(3)
+
+
+    def test_multi_window(self):
+        x = noisy(1000)
+        sizes = [1, 4, 16]
+        f = filters.MultiWindowMovingAverageFilter(sizes)
+        self.assertEqual(f.getWindowSizes(), sizes)
+        y = f.process(x)
+        self.assertEqual(y.shape, (3, 1000))
+        g = filters.MultiWindowMovingAverageFilter(sizes)
+        np.testing.assert_allclose(y, np.array([g.update(v) for v in x]).T, rtol=1e-12)
+        for w, size in enumerate(sizes):
+            np.testing.assert_allclose(y[w], per_sample(lambda: filters.MovingAverageFilter(size), x), rtol=1e-12)
+            self.assertAlmostEqual(f.getAverage(w), y[w, -1], places=12)
+        with self.assertRaises(IndexError):
+            f.getAverage(3)
+
+    def test_rts_smoother(self):
+        z = noisy(1000)
+        kf = filters.SimpleKalmanFilter()
+        kf.setProcessNoise(0.01)
+        rts = filters.RtsSmoother(kf)
+        var = np.empty_like(z)
+        xs = rts.smooth(z, variance=var)
+        self.assertTrue(np.all(var > 0.0))
+        # The last smoothed sample is the filtered one.
+        self.assertAlmostEqual(xs[-1], kf.process(z)[-1], places=12)
+        np.testing.assert_allclose(rts.smoothParallel(z, threads=4), xs, rtol=1e-9, atol=1e-9)
+        with self.assertRaises(TypeError):
+            filters.RtsSmoother(filters.LowPassFilter())
+
+
+class NoConversion(unittest.TestCase):
+    def test_float32_rejected(self):
+        with self.assertRaises(TypeError):
+            filters.LowPassFilter().process(np.ones(10, dtype=np.float32))
+
+    def test_int_and_list_rejected(self):
+        with self.assertRaises(TypeError):
+            filters.MovingAverageFilter(4).process(np.arange(10))
+        with self.assertRaises(TypeError):
+            filters.MovingAverageFilter(4).process([1.0, 2.0, 3.0])
+
+    def test_non_contiguous_rejected(self):
+        x = np.ones(20)
+        with self.assertRaises(TypeError):
+            filters.SimpleKalmanFilter().process(x[::2])
+        with self.assertRaises(TypeError):
+            filters.RunningAverageFilterBank(4).process(np.ones((5, 4)).T)
+
+    def test_bad_out(self):
+        x = np.ones(10)
+        with self.assertRaises(ValueError):
+            filters.LowPassFilter().process(x, out=np.empty(9))
+        with self.assertRaises(TypeError):
+            filters.LowPassFilter().process(x, out=np.empty(10, dtype=np.float32))
+        ro = np.empty(10)
+        ro.flags.writeable = False
+        with self.assertRaises(ValueError):
+            filters.LowPassFilter().process(x, out=ro)
+
+    def test_rejected_arrays_are_released(self):
+        x32 = np.zeros(10, dtype=np.float32)
+        strided = np.zeros(20)[::2]
+        ro = np.empty(10)
+        ro.flags.writeable = False
+        before = [sys.getrefcount(a) for a in (x32, strided, ro)]
+        for _ in range(100):
+            with self.assertRaises(TypeError):
+                filters.LowPassFilter().process(x32)
+            with self.assertRaises(TypeError):
+                filters.LowPassFilter().process(strided)
+            with self.assertRaises(ValueError):
+                filters.LowPassFilter().process(np.ones(10), out=ro)
+        self.assertEqual([sys.getrefcount(a) for a in (x32, strided, ro)], before)
+        x32.resize(20)  # fails while a buffer export is still held
+
+    def test_cpp_errors_map_to_value_error(self):
+        with self.assertRaises(ValueError):
+            filters.LowPassFilter().setTimeConstant(0.0)
+
+
+class OutputBuffers(unittest.TestCase):
+    def test_out_is_written_and_returned(self):
+        x = noisy(1000)
+        out = np.empty_like(x)
+        y = filters.LowPassFilter(0.9).process(x, out=out)
+        self.assertIs(y, out)
+        np.testing.assert_array_equal(out, filters.LowPassFilter(0.9).process(x))
+
+    def test_in_place(self):
+        x = noisy(1000)
+        expected = filters.SimpleKalmanFilter().process(x)
+        y = filters.SimpleKalmanFilter().process(x, out=x)
+        self.assertIs(y, x)
+        np.testing.assert_array_equal(x, expected)
+
+    def test_row_views_are_not_copied(self):
+        # A contiguous row of a 2-D array is accepted as is and filtered in place
+        data = np.ascontiguousarray(np.tile(noisy(500), (2, 1)))
+        expected = filters.MovingAverageFilter(8).process(data[1])
+        filters.MovingAverageFilter(8).process(data[1], out=data[1])
+        np.testing.assert_array_equal(data[1], expected)
+        np.testing.assert_array_equal(data[0], noisy(500))
+
+
+class Threads(unittest.TestCase):
+    def test_channels_in_parallel_threads(self):
+        channels = np.ascontiguousarray(np.stack([noisy(200_000, seed=s) for s in range(8)]))
+        serial = [filters.SimpleKalmanFilter().process(c) for c in channels]
+
+        kfs = [filters.SimpleKalmanFilter() for _ in channels]
+        out = np.empty_like(channels)
+        with ThreadPoolExecutor(max_workers=4) as pool:
+            list(pool.map(lambda i: kfs[i].process(channels[i], out=out[i]), range(len(kfs))))
+
+        for c in range(len(kfs)):
+            np.testing.assert_array_equal(out[c], serial[c])
+
+    def test_gil_released_during_block(self):
+        # While a long block runs in a worker, the main thread keeps getting
+        # scheduled: its longest stall is far shorter than the block itself.
+        x = noisy(4_000_000)
+        kf = filters.SimpleKalmanFilter()
+        elapsed = []
+
+        def work():
+            t0 = time.perf_counter()
+            kf.process(x)
+            elapsed.append(time.perf_counter() - t0)
+
+        worker = threading.Thread(target=work)
+        last = time.perf_counter()
+        longest = 0.0
+        worker.start()
+        while worker.is_alive():
+            now = time.perf_counter()
+            longest = max(longest, now - last)
+            last = now
+        worker.join()
+        self.assertLess(longest, 0.5 * elapsed[0])
+
+
+class Sweep(unittest.TestCase):
+    def test_low_pass_sweep_matches_single_runs(self):
+        x = noisy(3000)
+        alphas = [0.1, 0.5, 0.9]
+        res = filters.sweepLowPassAlpha(x, alphas, skip=10, maxLag=0, threads=2)
+        self.assertEqual([r.param for r in res], alphas)
+        for a, r in zip(alphas, res):
+            y = filters.LowPassFilter(a).process(x)
+            self.assertAlmostEqual(r.rmse, float(np.sqrt(np.mean((y[10:] - x[10:]) ** 2))), places=9)
+
+    def test_kalman_sweep_uses_prototype(self):
+        x = noisy(3000)
+        proto = filters.SimpleKalmanFilter()
+        proto.setProcessNoise(0.01)
+        proto.setEstimate(10.0, 1.0)
+        res = filters.sweepKalmanMeasurementNoise(x, [0.5, 2.0], prototype=proto, reference=x, maxLag=0)
+        for r in res:
+            kf = filters.SimpleKalmanFilter()
+            kf.setProcessNoise(0.01)
+            kf.setEstimate(10.0, 1.0)
+            kf.setMeasurementNoise(r.param)
+            y = kf.process(x)
+            self.assertAlmostEqual(r.rmse, float(np.sqrt(np.mean((y - x) ** 2))), places=9)
+
+    def test_moving_average_sweep(self):
+        res = filters.sweepMovingAverageWindow(noisy(1000), [1, 4, 16])
+        self.assertEqual([r.param for r in res], [1.0, 4.0, 16.0])
+        self.assertAlmostEqual(res[0].rmse, 0.0)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,174 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "MovingAverageFilter.hpp"
+#include "SimpleKalmanFilter.hpp"
+
+namespace Filters
+{
+namespace Seek
+{
+
+// How to capture and restore a filter's state for FilteredSeriesIndex.
+// restore() receives the source series and the number of samples already fed,
+// so snapshots only need what cannot be rebuilt from the input. accepts()
+// rejects prototypes whose state restore() could not reproduce.
+template <class Filter>
+struct SnapshotTraits;
+
+template <>
+struct SnapshotTraits<Avg::MovingAverageFilter>
+{
+    using State = Avg::MovingAverageFilter::State;
+
+    // The window is rebuilt from the series alone, so samples a prototype
+    // saw before the series would be lost: it has to start in first-run state.
+    static bool accepts(const Avg::MovingAverageFilter& f) { return !f.getState().initialized; }
+
+    static State capture(const Avg::MovingAverageFilter& f) { return f.getState(); }
+
+    static void restore(Avg::MovingAverageFilter& f, const State& s, const double* x, std::size_t count)
+    {
+        f.setState(s, x, count);
+    }
+};
+
+template <>
+struct SnapshotTraits<Kalman::SimpleKalmanFilter>
+{
+    struct State
+    {
+        double x;
+        double p;
+    };
+
+    static bool accepts(const Kalman::SimpleKalmanFilter&) { return true; }
+
+    static State capture(const Kalman::SimpleKalmanFilter& f)
+    {
+        return State{f.getEstimate(), f.getErrorCovariance()};
+    }
+
+    static void restore(Kalman::SimpleKalmanFilter& f, const State& s, const double*, std::size_t)
+    {
+        f.setEstimate(s.x, s.p);
+    }
+};
+
+// Random access to the output of Filter::update over a long recording.
+//
+// Building runs the filter once and keeps a compact state snapshot every
+// `interval` samples. at(i) restores the nearest snapshot at or before i and
+// replays at most `interval` samples, so a lookup costs O(interval) instead of
+// O(i). Lookups are const and independent, so disjoint ranges can be
+// recomputed in parallel (rangeParallel).
+//
+// The index does not own the series; x must outlive it. A MovingAverageFilter
+// prototype must not have been updated yet (std::invalid_argument otherwise).
+template <class Filter>
+class FilteredSeriesIndex
+{
+public:
+    using Traits = SnapshotTraits<Filter>;
+    using State  = typename Traits::State;
+
+    FilteredSeriesIndex(const Filter& prototype, const double* x, std::size_t n, std::size_t interval)
+        : m_proto(prototype)
+        , m_x(x)
+        , m_n(n)
+        , m_interval(interval)
+    {
+        if (interval == 0) { throw std::invalid_argument("interval must be > 0"); }
+        if (!Traits::accepts(prototype))
+        {
+            throw std::invalid_argument("FilteredSeriesIndex: prototype state cannot be restored");
+        }
+
+        Filter f = m_proto;
+        m_snaps.reserve(n / interval + 1);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (i % interval == 0)
+            {
+                m_snaps.push_back(Traits::capture(f));
+            }
+            (void)f.update(x[i]);
+        }
+    }
+
+    std::size_t size() const { return m_n; }
+    std::size_t getInterval() const { return m_interval; }
+    std::size_t getSnapshotCount() const { return m_snaps.size(); }
+
+    // Filter output after feeding x[0..i]
+    double at(std::size_t i) const
+    {
+        double y = 0.0;
+        range(i, i + 1, &y);
+        return y;
+    }
+
+    // Filter outputs for samples [begin, end) written to out[0..end-begin)
+    void range(std::size_t begin, std::size_t end, double* out) const
+    {
+        if (begin > end || end > m_n) { throw std::out_of_range("FilteredSeriesIndex: range out of bounds"); }
+        if (begin == end) return;
+
+        const std::size_t j = begin / m_interval;
+        const std::size_t start = j * m_interval;
+
+        Filter f = m_proto;
+        Traits::restore(f, m_snaps[j], m_x, start);
+        for (std::size_t i = start; i < begin; ++i)
+        {
+            (void)f.update(m_x[i]);
+        }
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            out[i - begin] = f.update(m_x[i]);
+        }
+    }
+
+    // Same as range(), split into contiguous chunks recomputed on `threads`
+    // threads (0 = hardware_concurrency).
+    void rangeParallel(std::size_t begin, std::size_t end, double* out, unsigned threads = 0) const
+    {
+        if (begin > end || end > m_n) { throw std::out_of_range("FilteredSeriesIndex: range out of bounds"); }
+        if (threads == 0)
+        {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        // No point in chunks shorter than one snapshot interval
+        const std::size_t len = end - begin;
+        const std::size_t chunks = std::max<std::size_t>(1, std::min<std::size_t>(threads, len / m_interval));
+
+        std::vector<std::thread> pool;
+        pool.reserve(chunks - 1);
+        std::size_t b = begin;
+        for (std::size_t c = 0; c < chunks; ++c)
+        {
+            const std::size_t e = b + (end - b) / (chunks - c);
+            if (c + 1 < chunks)
+                pool.emplace_back([this, b, e, out, begin]() { range(b, e, out + (b - begin)); });
+            else
+                range(b, e, out + (b - begin));
+            b = e;
+        }
+        for (std::thread& t : pool) t.join();
+    }
+
+private:
+    Filter             m_proto;
+    const double*      m_x;
+    std::size_t        m_n;
+    std::size_t        m_interval;
+    std::vector<State> m_snaps;   // m_snaps[j]: state after j * interval updates
+};
+
+} // namespace Seek
+} // namespace Filters
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <random>
+#include <vector>
+
+#include "FilteredSeriesIndex.hpp"
+#include "CsvData.hpp"
+
+using Filters::Avg::MovingAverageFilter;
+using Filters::Kalman::SimpleKalmanFilter;
+using Filters::Seek::FilteredSeriesIndex;
+
+static std::vector<double> Noisy(std::size_t n, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> dist(14.4, 4.0);
+    std::vector<double> x(n);
+    for (double& v : x) v = dist(rng);
+    return x;
+}
+
+template <class Filter>
+static std::vector<double> Replay(Filter f, const std::vector<double>& x)
+{
+    std::vector<double> y(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i) y[i] = f.update(x[i]);
+    return y;
+}
+
+TEST(FilteredSeriesIndex, RejectsZeroInterval)
+{
+    std::vector<double> x(10, 1.0);
+    EXPECT_THROW((FilteredSeriesIndex<SimpleKalmanFilter>(SimpleKalmanFilter(), x.data(), x.size(), 0)),
+                 std::invalid_argument);
+}
+
+TEST(FilteredSeriesIndex, RejectsWarmedUpMovingAverage)
+{
+    std::vector<double> x(10, 1.0);
+    MovingAverageFilter proto(4);
+    (void)proto.update(5.0);
+    EXPECT_THROW((FilteredSeriesIndex<MovingAverageFilter>(proto, x.data(), x.size(), 4)), std::invalid_argument);
+
+    // A warmed-up Kalman prototype is fully described by its (x, P) snapshot
+    SimpleKalmanFilter kf;
+    (void)kf.update(5.0);
+    const std::vector<double> ref = Replay(kf, x);
+    FilteredSeriesIndex<SimpleKalmanFilter> idx(kf, x.data(), x.size(), 4);
+    EXPECT_DOUBLE_EQ(idx.at(9), ref[9]);
+}
+
+TEST(FilteredSeriesIndex, MovingAverageRandomAccessMatchesReplay)
+{
+    const std::vector<double> x = Noisy(20000, 1);
+
+    // Interval shorter and longer than the window, and not a multiple of it
+    for (std::size_t interval : {7u, 64u, 1000u})
+    {
+        const MovingAverageFilter proto(100);
+        const std::vector<double> ref = Replay(proto, x);
+        FilteredSeriesIndex<MovingAverageFilter> idx(proto, x.data(), x.size(), interval);
+        EXPECT_EQ(idx.getSnapshotCount(), (x.size() + interval - 1) / interval);
+
+        std::mt19937 rng(interval);
+        std::uniform_int_distribution<std::size_t> pick(0, x.size() - 1);
+        for (int q = 0; q < 200; ++q)
+        {
+            const std::size_t i = pick(rng);
+            EXPECT_DOUBLE_EQ(idx.at(i), ref[i]) << "interval=" << interval << " i=" << i;
+        }
+        EXPECT_DOUBLE_EQ(idx.at(0), ref[0]);
+        EXPECT_DOUBLE_EQ(idx.at(x.size() - 1), ref.back());
+    }
+}
+
+TEST(FilteredSeriesIndex, KalmanRangeMatchesReplay)
+{
+    const std::vector<double> x = Noisy(5000, 2);
+    SimpleKalmanFilter proto;
+    proto.setProcessNoise(0.1);
+    const std::vector<double> ref = Replay(proto, x);
+
+    FilteredSeriesIndex<SimpleKalmanFilter> idx(proto, x.data(), x.size(), 128);
+    std::vector<double> out(900);
+    idx.range(1234, 1234 + out.size(), out.data());
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(out[i], ref[1234 + i]);
+    }
+
+    EXPECT_THROW(idx.range(10, x.size() + 1, out.data()), std::out_of_range);
+}
+
+TEST(FilteredSeriesIndex, ParallelRangeMatchesReplay)
+{
+    const std::vector<double> x = Noisy(50000, 3);
+    const MovingAverageFilter proto(250);
+    const std::vector<double> ref = Replay(proto, x);
+
+    FilteredSeriesIndex<MovingAverageFilter> idx(proto, x.data(), x.size(), 512);
+    std::vector<double> out(x.size() - 333);
+    idx.rangeParallel(333, x.size(), out.data(), 6);
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        ASSERT_DOUBLE_EQ(out[i], ref[333 + i]) << "i=" << i;
+    }
+}
+
+TEST(FilteredSeriesIndex, SonarAltSeek)
+{
+    const std::string csvPath = std::string(DATA_DIR) + "/SonarAlt.csv";
+    if (!std::filesystem::exists(csvPath))
+    {
+        GTEST_SKIP() << "Input CSV not found at '" << csvPath << "'.";
+    }
+
+    CsvSeries s = CsvIO::Load(csvPath, "t", "z");
+    ASSERT_FALSE(s.y.empty()) << "CSV had no rows: " << csvPath;
+
+    const MovingAverageFilter proto(10);
+    const std::vector<double> ref = Replay(proto, s.y);
+    FilteredSeriesIndex<MovingAverageFilter> idx(proto, s.y.data(), s.y.size(), 50);
+    for (std::size_t i = 0; i < s.y.size(); i += 37)
+    {
+        EXPECT_DOUBLE_EQ(idx.at(i), ref[i]);
+    }
+}
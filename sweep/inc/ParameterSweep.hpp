@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include "SimpleKalmanFilter.hpp"
+
+namespace Filters
+{
+namespace Sweep
+{
+
+struct SweepOptions
+{
+    const double* reference{nullptr};  // series to score against (n samples); nullptr = the input
+    std::size_t   skip{0};             // leading samples excluded from all metrics (warm-up)
+    std::size_t   maxLag{16};          // lag search range in samples; 0 disables the search
+    unsigned      threads{1};          // worker threads; 0 = std::thread::hardware_concurrency()
+};
+
+struct SweepResult
+{
+    double      param{0.0};            // candidate value (alpha, window size or R)
+    double      rmse{0.0};             // sqrt(mean((y - ref)^2))
+    double      residualStdDev{0.0};   // std(y - ref), N-1 in the denominator (as CsvIO::StdDev)
+    std::size_t lag{0};                // shift L in [0, maxLag] minimizing mean((y_k - ref_{k-L})^2)
+};
+
+// Evaluates many parameter candidates of a filter in one pass over the input.
+// Candidates are laid out as structure-of-arrays lanes so the per-sample inner
+// loop vectorizes, and are split across threads in contiguous groups. Each
+// lane uses the same arithmetic as one filter instance per candidate; only the
+// metrics are kept, no filtered series is written.
+class ParameterSweep
+{
+public:
+    // LowPassFilter(alpha)::update over the input, one lane per alpha.
+    static std::vector<SweepResult> lowPassAlpha(const double* x, std::size_t n,
+                                                 const std::vector<double>& alphas,
+                                                 const SweepOptions& opt = {});
+
+    // MovingAverageFilter(N)::update over the input, one lane per window size.
+    // Throws std::invalid_argument for a zero window.
+    static std::vector<SweepResult> movingAverageWindow(const double* x, std::size_t n,
+                                                        const std::vector<std::size_t>& windows,
+                                                        const SweepOptions& opt = {});
+
+    // SimpleKalmanFilter::update over the input, one lane per measurement
+    // noise R. Everything else (A, H, Q, initial estimate/covariance, innovation
+    // gate and Huber threshold) comes from the prototype.
+    static std::vector<SweepResult> kalmanMeasurementNoise(const double* x, std::size_t n,
+                                                           const std::vector<double>& rs,
+                                                           const Kalman::SimpleKalmanFilter& prototype = {},
+                                                           const SweepOptions& opt = {});
+
+    // Index of the candidate with the smallest RMSE (0 if results is empty).
+    static std::size_t best(const std::vector<SweepResult>& results);
+};
+
+} // namespace Sweep
+} // namespace Filters
@@ -0,0 +1,387 @@
+#include "ParameterSweep.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+/*
+One-pass parameter sweep.
+
+Instead of re-running the whole series once per candidate, every candidate is
+a lane of a structure-of-arrays state and each input sample is pushed through
+all lanes before moving on:
+
+    for k in 0..n-1:
+        for c in lanes:  y[c] = step_c(x[k])          (vectorizable over c)
+        for c in lanes:  accumulate metrics of y[c] vs ref[k], ref[k-1], ...
+
+The per-lane arithmetic is written in the same order as the scalar filters,
+so outputs match one filter instance per candidate (up to FMA contraction).
+Lanes are split into contiguous groups, one per thread; all threads read the
+same input.
+
+Metrics over k >= skip, with e_k = y_k - ref_k:
+
+    rmse           = sqrt(sum e^2 / m)
+    residualStdDev = sqrt((sum e^2 - (sum e)^2 / m) / (m - 1))
+    lag            = argmin_{L in [0, maxLag]} mean_{k >= max(skip, L)} (y_k - ref_{k-L})^2
+*/
+
+namespace Filters
+{
+namespace Sweep
+{
+
+namespace
+{
+
+// Streaming metric accumulators for a group of lanes.
+class Scorer
+{
+public:
+    Scorer(std::size_t lanes, const double* ref, std::size_t maxLag)
+        : m_lanes(lanes)
+        , m_ref(ref)
+        , m_maxLag(maxLag)
+        , m_sum(lanes, 0.0)
+        , m_sum2(lanes, 0.0)
+        , m_lag(lanes * maxLag, 0.0)
+    {
+    }
+
+    void add(std::size_t k, const double* y)
+    {
+        const std::size_t C = m_lanes;
+        const double r0 = m_ref[k];
+        double* s1 = m_sum.data();
+        double* s2 = m_sum2.data();
+        for (std::size_t c = 0; c < C; ++c)
+        {
+            const double e = y[c] - r0;
+            s1[c] += e;
+            s2[c] += e * e;
+        }
+
+        const std::size_t lmax = std::min(m_maxLag, k);
+        for (std::size_t L = 1; L <= lmax; ++L)
+        {
+            const double r = m_ref[k - L];
+            double* acc = m_lag.data() + (L - 1) * C;
+            for (std::size_t c = 0; c < C; ++c)
+            {
+                const double d = y[c] - r;
+                acc[c] += d * d;
+            }
+        }
+    }
+
+    void finish(std::size_t n, std::size_t skip, SweepResult* out) const
+    {
+        const double m = static_cast<double>(n > skip ? n - skip : 0);
+        for (std::size_t c = 0; c < m_lanes; ++c)
+        {
+            SweepResult& res = out[c];
+            res.rmse = (m > 0.0) ? std::sqrt(m_sum2[c] / m) : 0.0;
+            res.residualStdDev = (m > 1.0)
+                ? std::sqrt(std::max(m_sum2[c] - m_sum[c] * m_sum[c] / m, 0.0) / (m - 1.0))
+                : 0.0;
+
+            res.lag = 0;
+            double bestMse = (m > 0.0) ? m_sum2[c] / m : 0.0;
+            for (std::size_t L = 1; L <= m_maxLag; ++L)
+            {
+                const std::size_t first = std::max(skip, L);
+                if (first >= n) break;
+                const double mse = m_lag[(L - 1) * m_lanes + c] / static_cast<double>(n - first);
+                if (mse < bestMse)
+                {
+                    bestMse = mse;
+                    res.lag = L;
+                }
+            }
+        }
+    }
+
+private:
+    std::size_t         m_lanes;
+    const double*       m_ref;
+    std::size_t         m_maxLag;
+    std::vector<double> m_sum;     // sum e_k
+    std::vector<double> m_sum2;    // sum e_k^2
+    std::vector<double> m_lag;     // [L-1][c]: sum (y_k - ref_{k-L})^2
+};
+
+// LowPassFilter::update per lane
+class LowPassLanes
+{
+public:
+    LowPassLanes(const double* alphas, std::size_t lanes)
+        : m_alpha(alphas, alphas + lanes)
+        , m_y(lanes, 0.0)
+    {
+    }
+
+    std::size_t lanes() const { return m_y.size(); }
+
+    void step(const double* x, std::size_t k, double* y)
+    {
+        const std::size_t C = m_y.size();
+        const double xk = x[k];
+        const double* a = m_alpha.data();
+        double* s = m_y.data();
+        if (k == 0)
+        {
+            std::fill(m_y.begin(), m_y.end(), xk);
+        }
+        for (std::size_t c = 0; c < C; ++c)
+        {
+            s[c] = a[c] * s[c] + (1.0 - a[c]) * xk;
+            y[c] = s[c];
+        }
+    }
+
+private:
+    std::vector<double> m_alpha;
+    std::vector<double> m_y;
+};
+
+// MovingAverageFilter::update per lane; the input series itself serves as the
+// shared sample history, so no per-lane ring buffer is needed.
+class MovingAverageLanes
+{
+public:
+    MovingAverageLanes(const std::size_t* windows, std::size_t lanes)
+        : m_n(windows, windows + lanes)
+        , m_nd(lanes)
+        , m_sum(lanes, 0.0)
+    {
+        for (std::size_t c = 0; c < lanes; ++c) m_nd[c] = static_cast<double>(m_n[c]);
+    }
+
+    std::size_t lanes() const { return m_sum.size(); }
+
+    void step(const double* x, std::size_t k, double* y)
+    {
+        const std::size_t C = m_sum.size();
+        const double xk = x[k];
+        const double* nd = m_nd.data();
+        double* s = m_sum.data();
+        if (k == 0)
+        {
+            // First run: window filled with x[0]
+            for (std::size_t c = 0; c < C; ++c)
+            {
+                s[c] = nd[c] * xk;
+                y[c] = s[c] / nd[c];
+            }
+            return;
+        }
+
+        const double x0 = x[0];
+        for (std::size_t c = 0; c < C; ++c)
+        {
+            const double old = (k >= m_n[c]) ? x[k - m_n[c]] : x0;
+            s[c] += xk - old;
+            y[c] = s[c] / nd[c];
+        }
+    }
+
+private:
+    std::vector<std::size_t> m_n;
+    std::vector<double>      m_nd;
+    std::vector<double>      m_sum;
+};
+
+// SimpleKalmanFilter::update per lane (shared A, H, Q, gate and Huber
+// threshold; per-lane R). The robust branch mirrors SimpleKalmanFilter::correct
+// and is only taken when the prototype enables gating or Huber weighting.
+class KalmanLanes
+{
+public:
+    KalmanLanes(const double* rs, std::size_t lanes, const Kalman::SimpleKalmanFilter& proto)
+        : m_r(rs, rs + lanes)
+        , m_x(lanes, proto.getEstimate())
+        , m_p(lanes, proto.getErrorCovariance())
+        , m_a(proto.getStateTransition())
+        , m_h(proto.getMeasurementModel())
+        , m_q(proto.getProcessNoise())
+        , m_gate(proto.getInnovationGate())
+        , m_huber(proto.getHuberThreshold())
+    {
+    }
+
+    std::size_t lanes() const { return m_r.size(); }
+
+    void step(const double* z, std::size_t k, double* y)
+    {
+        if (m_gate > 0.0 || m_huber > 0.0)
+        {
+            stepRobust(z[k], y);
+            return;
+        }
+
+        const std::size_t C = m_r.size();
+        const double zk = z[k];
+        const double a = m_a, h = m_h, q = m_q;
+        const double* r = m_r.data();
+        double* xs = m_x.data();
+        double* ps = m_p.data();
+        for (std::size_t c = 0; c < C; ++c)
+        {
+            const double xp = a * xs[c];
+            const double Pp = a * ps[c] * a + q;
+            const double K = Pp * h / (h * Pp * h + r[c]);
+            xs[c] = xp + K * (zk - h * xp);
+            ps[c] = Pp - K * h * Pp;
+            y[c] = xs[c];
+        }
+    }
+
+private:
+    void stepRobust(double zk, double* y)
+    {
+        const std::size_t C = m_r.size();
+        const double a = m_a, h = m_h, q = m_q;
+        const double gate = m_gate, huber = m_huber;
+        const double* r = m_r.data();
+        double* xs = m_x.data();
+        double* ps = m_p.data();
+        for (std::size_t c = 0; c < C; ++c)
+        {
+            const double xp = a * xs[c];
+            const double Pp = a * ps[c] * a + q;
+            const double nu = zk - h * xp;
+            const double d = std::abs(nu) / std::sqrt(h * Pp * h + r[c]);
+
+            if (gate > 0.0 && d > gate)
+            {
+                xs[c] = xp;
+                ps[c] = Pp;
+            }
+            else
+            {
+                const double rc = (huber > 0.0 && d > huber) ? r[c] * (d / huber) : r[c];
+                const double K = Pp * h / (h * Pp * h + rc);
+                xs[c] = xp + K * nu;
+                ps[c] = Pp - K * h * Pp;
+            }
+            y[c] = xs[c];
+        }
+    }
+
+    std::vector<double> m_r;
+    std::vector<double> m_x;
+    std::vector<double> m_p;
+    double              m_a;
+    double              m_h;
+    double              m_q;
+    double              m_gate;
+    double              m_huber;
+};
+
+template <class Lanes>
+void runGroup(Lanes lanes, const double* x, std::size_t n, const SweepOptions& opt, SweepResult* out)
+{
+    const double* ref = opt.reference ? opt.reference : x;
+    std::vector<double> y(lanes.lanes());
+    Scorer scorer(lanes.lanes(), ref, opt.maxLag);
+
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        lanes.step(x, k, y.data());
+        if (k >= opt.skip)
+        {
+            scorer.add(k, y.data());
+        }
+    }
+    scorer.finish(n, opt.skip, out);
+}
+
+// Splits [0, count) into contiguous groups and runs makeGroup(begin, end) on
+// each, one thread per group.
+template <class MakeGroup>
+void runParallel(std::size_t count, unsigned threads, MakeGroup makeGroup)
+{
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const std::size_t groups = std::min<std::size_t>(threads, count);
+    if (groups <= 1)
+    {
+        if (count > 0) makeGroup(0, count);
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    pool.reserve(groups - 1);
+    std::size_t begin = 0;
+    for (std::size_t g = 0; g < groups; ++g)
+    {
+        const std::size_t end = begin + (count - begin) / (groups - g);
+        if (g + 1 < groups)
+            pool.emplace_back(makeGroup, begin, end);
+        else
+            makeGroup(begin, end);
+        begin = end;
+    }
+    for (std::thread& t : pool) t.join();
+}
+
+} // namespace
+
+std::vector<SweepResult> ParameterSweep::lowPassAlpha(const double* x, std::size_t n,
+                                                      const std::vector<double>& alphas,
+                                                      const SweepOptions& opt)
+{
+    std::vector<SweepResult> results(alphas.size());
+    runParallel(alphas.size(), opt.threads, [&](std::size_t b, std::size_t e) {
+        runGroup(LowPassLanes(alphas.data() + b, e - b), x, n, opt, results.data() + b);
+    });
+    for (std::size_t c = 0; c < alphas.size(); ++c) results[c].param = alphas[c];
+    return results;
+}
+
+std::vector<SweepResult> ParameterSweep::movingAverageWindow(const double* x, std::size_t n,
+                                                             const std::vector<std::size_t>& windows,
+                                                             const SweepOptions& opt)
+{
+    for (std::size_t w : windows)
+    {
+        if (w == 0) { throw std::invalid_argument("windowSize must be > 0"); }
+    }
+
+    std::vector<SweepResult> results(windows.size());
+    runParallel(windows.size(), opt.threads, [&](std::size_t b, std::size_t e) {
+        runGroup(MovingAverageLanes(windows.data() + b, e - b), x, n, opt, results.data() + b);
+    });
+    for (std::size_t c = 0; c < windows.size(); ++c) results[c].param = static_cast<double>(windows[c]);
+    return results;
+}
+
+std::vector<SweepResult> ParameterSweep::kalmanMeasurementNoise(const double* x, std::size_t n,
+                                                                const std::vector<double>& rs,
+                                                                const Kalman::SimpleKalmanFilter& prototype,
+                                                                const SweepOptions& opt)
+{
+    std::vector<SweepResult> results(rs.size());
+    runParallel(rs.size(), opt.threads, [&](std::size_t b, std::size_t e) {
+        runGroup(KalmanLanes(rs.data() + b, e - b, prototype), x, n, opt, results.data() + b);
+    });
+    for (std::size_t c = 0; c < rs.size(); ++c) results[c].param = rs[c];
+    return results;
+}
+
+std::size_t ParameterSweep::best(const std::vector<SweepResult>& results)
+{
+    std::size_t idx = 0;
+    for (std::size_t c = 1; c < results.size(); ++c)
+    {
+        if (results[c].rmse < results[idx].rmse) idx = c;
+    }
+    return idx;
+}
+
+} // namespace Sweep
+} // namespace Filters
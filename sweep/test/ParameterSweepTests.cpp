@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+#include "ParameterSweep.hpp"
+#include "LowPassFilter.hpp"
+#include "MovingAverageFilter.hpp"
+#include "SimpleKalmanFilter.hpp"
+#include "CsvData.hpp"
+
+using namespace Filters;
+using Filters::Sweep::ParameterSweep;
+using Filters::Sweep::SweepOptions;
+using Filters::Sweep::SweepResult;
+
+static std::vector<double> NoisyRamp(std::size_t n, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> noise(0.0, 2.0);
+    std::vector<double> x(n);
+    for (std::size_t i = 0; i < n; ++i)
+        x[i] = 20.0 + 0.05 * static_cast<double>(i) + 5.0 * std::sin(0.01 * i) + noise(rng);
+    return x;
+}
+
+static std::vector<double> Clean(std::size_t n)
+{
+    std::vector<double> x(n);
+    for (std::size_t i = 0; i < n; ++i)
+        x[i] = 20.0 + 0.05 * static_cast<double>(i) + 5.0 * std::sin(0.01 * i);
+    return x;
+}
+
+// Straightforward metrics on a full filtered series
+static SweepResult Score(const std::vector<double>& y, const std::vector<double>& ref,
+                         std::size_t skip, std::size_t maxLag)
+{
+    SweepResult r;
+    std::vector<double> e;
+    for (std::size_t k = skip; k < y.size(); ++k) e.push_back(y[k] - ref[k]);
+
+    double s2 = 0.0;
+    for (double v : e) s2 += v * v;
+    r.rmse = std::sqrt(s2 / static_cast<double>(e.size()));
+    r.residualStdDev = CsvIO::StdDev(e);
+
+    double best = 1e300;
+    for (std::size_t L = 0; L <= maxLag; ++L)
+    {
+        double acc = 0.0;
+        std::size_t cnt = 0;
+        for (std::size_t k = std::max(skip, L); k < y.size(); ++k, ++cnt)
+            acc += (y[k] - ref[k - L]) * (y[k] - ref[k - L]);
+        if (acc / cnt < best) { best = acc / cnt; r.lag = L; }
+    }
+    return r;
+}
+
+static void ExpectSame(const SweepResult& a, const SweepResult& b, const char* what)
+{
+    EXPECT_NEAR(a.rmse, b.rmse, 1e-9 * b.rmse) << what;
+    EXPECT_NEAR(a.residualStdDev, b.residualStdDev, 1e-7 * b.residualStdDev) << what;
+    EXPECT_EQ(a.lag, b.lag) << what;
+}
+
+TEST(ParameterSweep, LowPassAlphaMatchesIndividualRuns)
+{
+    const std::size_t n = 3000;
+    const std::vector<double> x = NoisyRamp(n, 1);
+    const std::vector<double> ref = Clean(n);
+
+    std::vector<double> alphas;
+    for (int a = 0; a < 37; ++a) alphas.push_back(a / 37.0);
+
+    SweepOptions opt;
+    opt.reference = ref.data();
+    opt.skip = 50;
+    opt.maxLag = 24;
+    const std::vector<SweepResult> res = ParameterSweep::lowPassAlpha(x.data(), n, alphas, opt);
+    ASSERT_EQ(res.size(), alphas.size());
+
+    for (std::size_t c = 0; c < alphas.size(); ++c)
+    {
+        LPF::LowPassFilter f(alphas[c]);
+        std::vector<double> y(n);
+        f.process(x.data(), y.data(), n);
+        EXPECT_DOUBLE_EQ(res[c].param, alphas[c]);
+        ExpectSame(res[c], Score(y, ref, opt.skip, opt.maxLag), "lpf");
+    }
+}
+
+TEST(ParameterSweep, MovingAverageWindowMatchesIndividualRuns)
+{
+    const std::size_t n = 2500;
+    const std::vector<double> x = NoisyRamp(n, 2);
+
+    const std::vector<std::size_t> windows = {1, 2, 5, 10, 33, 100, 400, 3000};
+    SweepOptions opt;
+    opt.maxLag = 8;
+    const std::vector<SweepResult> res = ParameterSweep::movingAverageWindow(x.data(), n, windows, opt);
+
+    for (std::size_t c = 0; c < windows.size(); ++c)
+    {
+        Avg::MovingAverageFilter f(windows[c]);
+        std::vector<double> y(n);
+        f.process(x.data(), y.data(), n);
+        ExpectSame(res[c], Score(y, x, 0, opt.maxLag), "movavg");
+    }
+
+    EXPECT_THROW(ParameterSweep::movingAverageWindow(x.data(), n, {4, 0}), std::invalid_argument);
+}
+
+TEST(ParameterSweep, KalmanMeasurementNoiseMatchesIndividualRuns)
+{
+    const std::size_t n = 2000;
+    const std::vector<double> x = NoisyRamp(n, 3);
+    const std::vector<double> ref = Clean(n);
+
+    Kalman::SimpleKalmanFilter proto;
+    proto.setProcessNoise(0.05);
+    proto.setEstimate(20.0, 4.0);
+
+    const std::vector<double> rs = {0.1, 0.5, 1.0, 2.0, 4.0, 8.0, 16.0};
+    SweepOptions opt;
+    opt.reference = ref.data();
+    const std::vector<SweepResult> res = ParameterSweep::kalmanMeasurementNoise(x.data(), n, rs, proto, opt);
+
+    for (std::size_t c = 0; c < rs.size(); ++c)
+    {
+        Kalman::SimpleKalmanFilter f = proto;
+        f.setMeasurementNoise(rs[c]);
+        std::vector<double> y(n);
+        f.process(x.data(), y.data(), n);
+        ExpectSame(res[c], Score(y, ref, 0, opt.maxLag), "kalman");
+    }
+}
+
+TEST(ParameterSweep, KalmanSweepAppliesPrototypeGateAndHuber)
+{
+    const std::size_t n = 2000;
+    std::vector<double> x = NoisyRamp(n, 9);
+    for (std::size_t i = 50; i < n; i += 97) x[i] += 60.0;  // outliers
+    const std::vector<double> ref = Clean(n);
+
+    const std::vector<double> rs = {0.5, 2.0, 4.0, 16.0};
+    SweepOptions opt;
+    opt.reference = ref.data();
+
+    for (int mode = 0; mode < 2; ++mode)
+    {
+        Kalman::SimpleKalmanFilter proto;
+        proto.setProcessNoise(0.05);
+        proto.setEstimate(20.0, 4.0);
+        if (mode == 0) proto.setInnovationGate(3.0);
+        else proto.setHuberThreshold(1.5);
+
+        const std::vector<SweepResult> res = ParameterSweep::kalmanMeasurementNoise(x.data(), n, rs, proto, opt);
+        for (std::size_t c = 0; c < rs.size(); ++c)
+        {
+            Kalman::SimpleKalmanFilter f = proto;
+            f.setMeasurementNoise(rs[c]);
+            std::vector<double> y(n);
+            f.process(x.data(), y.data(), n);
+            EXPECT_GT(f.getRejectedCount() + f.getDownweightedCount(), 0u);
+            ExpectSame(res[c], Score(y, ref, 0, opt.maxLag), mode == 0 ? "gate" : "huber");
+        }
+    }
+}
+
+TEST(ParameterSweep, ThreadedResultsEqualSingleThreaded)
+{
+    const std::size_t n = 4000;
+    const std::vector<double> x = NoisyRamp(n, 4);
+
+    std::vector<double> alphas;
+    for (int a = 0; a < 300; ++a) alphas.push_back(a / 300.0);
+
+    SweepOptions one, many;
+    many.threads = 7;
+    const auto a = ParameterSweep::lowPassAlpha(x.data(), n, alphas, one);
+    const auto b = ParameterSweep::lowPassAlpha(x.data(), n, alphas, many);
+    ASSERT_EQ(a.size(), b.size());
+    for (std::size_t c = 0; c < a.size(); ++c)
+    {
+        EXPECT_DOUBLE_EQ(a[c].param, b[c].param);
+        EXPECT_DOUBLE_EQ(a[c].rmse, b[c].rmse);
+        EXPECT_DOUBLE_EQ(a[c].residualStdDev, b[c].residualStdDev);
+        EXPECT_EQ(a[c].lag, b[c].lag);
+    }
+}
+
+TEST(ParameterSweep, BestPicksSmallestRmse)
+{
+    std::vector<SweepResult> res(4);
+    res[0].rmse = 3.0;
+    res[1].rmse = 1.5;
+    res[2].rmse = 2.0;
+    res[3].rmse = 1.5;
+    EXPECT_EQ(ParameterSweep::best(res), 1u);
+    EXPECT_EQ(ParameterSweep::best({}), 0u);
+}
+
+TEST(ParameterSweep, SonarAltLagGrowsWithAlpha)
+{
+    const std::string csvPath = std::string(DATA_DIR) + "/SonarAlt.csv";
+    if (!std::filesystem::exists(csvPath))
+    {
+        GTEST_SKIP() << "Input CSV not found at '" << csvPath << "'.";
+    }
+
+    CsvSeries s = CsvIO::Load(csvPath, "t", "z");
+    ASSERT_FALSE(s.y.empty()) << "CSV had no usable rows: " << csvPath;
+
+    SweepOptions opt;
+    opt.maxLag = 32;
+    opt.threads = 0;
+    const std::vector<double> alphas = {0.1, 0.5, 0.8, 0.9, 0.95};
+    const auto res = ParameterSweep::lowPassAlpha(s.y.data(), s.y.size(), alphas, opt);
+
+    for (std::size_t c = 1; c < res.size(); ++c)
+    {
+        EXPECT_GE(res[c].lag, res[c - 1].lag);
+        EXPECT_GT(res[c].rmse, res[c - 1].rmse);
+    }
+    EXPECT_GT(res.back().lag, 0u);
+}
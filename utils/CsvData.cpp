@@ -7,6 +7,12 @@
 #include <algorithm>
 #include <numeric>
 #include <cmath>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <thread>
 
 using namespace std;
 
@@ -79,6 +85,247 @@ CsvSeries CsvIO::Load(const string& csvPath, const string& xcol, const string& y
     return data;
 }
 
+/*
+LoadColumns: single-pass, column-major loader.
+
+  1. Read the whole file into memory and parse the header.
+  2. Map each CSV field index to an output column (or -1 = skip). Skipped
+     fields are stepped over with memchr(',') and never converted, and a line
+     is abandoned as soon as the last selected field has been read.
+  3. Split the body into chunks at line boundaries. Each chunk counts its rows
+     first; a prefix sum gives every chunk its first output row, so the second
+     pass can write values straight into their final column-major slots with
+     no merging. Both passes run one thread per chunk.
+*/
+
+namespace
+{
+
+// Calls fn(begin, end) for every non-empty line in [b, e), without the line
+// terminator ("\n" or "\r\n").
+template <class Fn>
+void forEachLine(const char* b, const char* e, Fn&& fn)
+{
+    while (b < e)
+    {
+        const char* nl = static_cast<const char*>(memchr(b, '\n', static_cast<size_t>(e - b)));
+        const char* le = nl ? nl : e;
+        if (le > b && le[-1] == '\r') --le;
+        if (le > b) fn(b, le);
+        b = nl ? nl + 1 : e;
+    }
+}
+
+bool isBlank(const char* b, const char* e)
+{
+    while (b < e && isspace(static_cast<unsigned char>(*b))) ++b;
+    return b == e;
+}
+
+// Parses [b, e) as a double, allowing surrounding whitespace.
+bool parseField(const char* b, const char* e, double& v)
+{
+    while (b < e && isspace(static_cast<unsigned char>(*b))) ++b;
+    if (b == e) return false;
+    char* stop = nullptr;
+    v = strtod(b, &stop);
+    if (stop == b) return false;
+    while (stop < e && isspace(static_cast<unsigned char>(*stop))) ++stop;
+    return stop == e;
+}
+
+// Splits [b, e) into up to n ranges, each ending just after a newline.
+vector<pair<const char*, const char*>> splitLines(const char* b, const char* e, size_t n)
+{
+    vector<pair<const char*, const char*>> chunks;
+    const size_t len = static_cast<size_t>(e - b);
+    const char* start = b;
+    for (size_t i = 1; i <= n && start < e; ++i)
+    {
+        const char* cut = (i == n) ? e : b + len * i / n;
+        if (cut < start) cut = start;
+        if (cut < e)
+        {
+            const char* nl = static_cast<const char*>(memchr(cut, '\n', static_cast<size_t>(e - cut)));
+            cut = nl ? nl + 1 : e;
+        }
+        chunks.emplace_back(start, cut);
+        start = cut;
+    }
+    return chunks;
+}
+
+// Runs fn(i) for i in [0, n) on one thread each; rethrows the first exception.
+template <class Fn>
+void runChunks(size_t n, Fn&& fn)
+{
+    if (n <= 1)
+    {
+        if (n == 1) fn(0);
+        return;
+    }
+
+    vector<exception_ptr> errors(n);
+    vector<thread> pool;
+    pool.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        pool.emplace_back([&, i]() {
+            try { fn(i); }
+            catch (...) { errors[i] = current_exception(); }
+        });
+    }
+    for (thread& t : pool) t.join();
+    for (const exception_ptr& e : errors)
+        if (e) rethrow_exception(e);
+}
+
+} // namespace
+
+const double* CsvTable::column(const string& name) const
+{
+    for (size_t c = 0; c < names.size(); ++c)
+        if (names[c] == name) return column(c);
+    throw runtime_error("CsvTable::column: column '" + name + "' not loaded");
+}
+
+CsvTable CsvIO::LoadColumns(const string& csvPath, const vector<string>& columns, unsigned threads)
+{
+    ifstream in(csvPath, ios::binary);
+    if (!in.is_open())
+        throw runtime_error("CsvIO::LoadColumns: failed to open: " + csvPath);
+
+    string buf;
+    in.seekg(0, ios::end);
+    buf.resize(static_cast<size_t>(in.tellg()));
+    in.seekg(0, ios::beg);
+    in.read(&buf[0], static_cast<streamsize>(buf.size()));
+
+    const char* const fileBegin = buf.data();
+    const char* const fileEnd = fileBegin + buf.size();
+
+    // Header
+    const char* hdrEnd = static_cast<const char*>(memchr(fileBegin, '\n', buf.size()));
+    if (buf.empty() || hdrEnd == fileBegin)
+        throw runtime_error("CsvIO::LoadColumns: CSV has no header: " + csvPath);
+    if (!hdrEnd) hdrEnd = fileEnd;
+
+    vector<string> cols;
+    {
+        string header(fileBegin, hdrEnd);
+        istringstream hs(header);
+        string tok;
+        while (getline(hs, tok, ','))
+        {
+            trim(tok);
+            cols.push_back(tok);
+        }
+    }
+    const char* bodyBegin = (hdrEnd < fileEnd) ? hdrEnd + 1 : fileEnd;
+
+    // Field index -> output column
+    CsvTable table;
+    vector<int> fieldToOut(cols.size(), -1);
+    if (columns.empty())
+    {
+        // Every column whose first non-blank value parses as a number. Rows
+        // are scanned only until each column has shown a value.
+        vector<char> numeric(cols.size(), 0), decided(cols.size(), 0);
+        size_t undecided = cols.size();
+        const char* b = bodyBegin;
+        while (b < fileEnd && undecided > 0)
+        {
+            const char* nl = static_cast<const char*>(memchr(b, '\n', static_cast<size_t>(fileEnd - b)));
+            const char* le = nl ? nl : fileEnd;
+            if (le > b && le[-1] == '\r') --le;
+
+            const char* p = b;
+            for (size_t f = 0; f < cols.size() && le > b; ++f)
+            {
+                const char* comma = static_cast<const char*>(memchr(p, ',', static_cast<size_t>(le - p)));
+                const char* fe = comma ? comma : le;
+                if (!decided[f] && !isBlank(p, fe))
+                {
+                    double v;
+                    numeric[f] = parseField(p, fe, v);
+                    decided[f] = 1;
+                    --undecided;
+                }
+                if (!comma) break;
+                p = comma + 1;
+            }
+            b = nl ? nl + 1 : fileEnd;
+        }
+        for (size_t f = 0; f < cols.size(); ++f)
+        {
+            if (numeric[f])
+            {
+                fieldToOut[f] = static_cast<int>(table.names.size());
+                table.names.push_back(cols[f]);
+            }
+        }
+    }
+    else
+    {
+        for (const string& name : columns)
+        {
+            auto it = find(cols.begin(), cols.end(), name);
+            if (it == cols.end())
+                throw runtime_error("CsvIO::LoadColumns: column '" + name + "' not found in " + csvPath);
+            const size_t f = static_cast<size_t>(it - cols.begin());
+            if (fieldToOut[f] >= 0)
+                throw runtime_error("CsvIO::LoadColumns: column '" + name + "' requested twice");
+            fieldToOut[f] = static_cast<int>(table.names.size());
+            table.names.push_back(name);
+        }
+    }
+
+    int lastField = -1;
+    for (size_t f = 0; f < fieldToOut.size(); ++f)
+        if (fieldToOut[f] >= 0) lastField = static_cast<int>(f);
+
+    // Pass 1: rows per chunk
+    if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+    const auto chunks = splitLines(bodyBegin, fileEnd, threads);
+    vector<size_t> firstRow(chunks.size() + 1, 0);
+    runChunks(chunks.size(), [&](size_t i) {
+        size_t rows = 0;
+        forEachLine(chunks[i].first, chunks[i].second, [&](const char*, const char*) { ++rows; });
+        firstRow[i + 1] = rows;
+    });
+    for (size_t i = 0; i < chunks.size(); ++i) firstRow[i + 1] += firstRow[i];
+
+    table.rows = firstRow.back();
+    table.data.assign(table.names.size() * table.rows, numeric_limits<double>::quiet_NaN());
+    if (lastField < 0) return table;
+
+    // Pass 2: parse selected fields into their column-major slots
+    const size_t rows = table.rows;
+    double* const out = table.data.data();
+    runChunks(chunks.size(), [&](size_t i) {
+        size_t r = firstRow[i];
+        forEachLine(chunks[i].first, chunks[i].second, [&](const char* b, const char* e) {
+            const char* p = b;
+            for (int f = 0; f <= lastField; ++f)
+            {
+                const char* comma = static_cast<const char*>(memchr(p, ',', static_cast<size_t>(e - p)));
+                const char* fe = comma ? comma : e;
+                const int c = fieldToOut[static_cast<size_t>(f)];
+                if (c >= 0 && !isBlank(p, fe) && !parseField(p, fe, out[static_cast<size_t>(c) * rows + r]))
+                {
+                    throw runtime_error("CsvIO::LoadColumns: bad value '" + string(p, fe) + "' in column '" +
+                                        table.names[static_cast<size_t>(c)] + "' of " + csvPath);
+                }
+                if (!comma) break;
+                p = comma + 1;
+            }
+            ++r;
+        });
+    });
+
+    return table;
+}
+
 void CsvIO::Write3(const string& csvPath,
                    const vector<double>& t,
                    const vector<double>& y1,
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -8,6 +9,21 @@ struct CsvSeries
     std::vector<double> y;  // signal
 };
 
+// Several columns loaded in one pass, stored column-major so each column is a
+// contiguous block (e.g. one channel of a filter bank).
+struct CsvTable
+{
+    std::vector<std::string> names;  // column names, in load order
+    std::size_t rows{0};
+    std::vector<double> data;        // column c occupies data[c * rows, (c + 1) * rows)
+
+    const double* column(std::size_t c) const { return data.data() + c * rows; }
+    double* column(std::size_t c) { return data.data() + c * rows; }
+
+    // Throws std::runtime_error if the column was not loaded.
+    const double* column(const std::string& name) const;
+};
+
 class CsvIO
 {
 public:
@@ -18,6 +34,17 @@ public:
                           const std::string& xcol = "t",
                           const std::string& ycol = "z");
 
+    // Load several columns by name in a single pass over the file. Fields of
+    // other columns are skipped without being parsed. An empty list selects
+    // every column whose first non-blank value is numeric. Missing or empty
+    // fields are NaN.
+    // threads > 1 parses chunks split at line boundaries in parallel
+    // (0 = std::thread::hardware_concurrency()).
+    // Throws std::runtime_error on errors.
+    static CsvTable LoadColumns(const std::string& csvPath,
+                                const std::vector<std::string>& columns = {},
+                                unsigned threads = 1);
+
     // Write 3-column CSV with a header (default names: t, y, avg).
     static void Write3(const std::string& csvPath,
                        const std::vector<double>& t,
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "CsvData.hpp"
+#include "RunningAverageFilterBank.hpp"
+
+namespace fs = std::filesystem;
+
+// Path in the temp directory, unique per process and test; the file is removed
+// when the object goes out of scope.
+class TempCsv
+{
+public:
+    TempCsv()
+    {
+        static unsigned counter = 0;
+        const ::testing::TestInfo* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        m_path = fs::temp_directory_path() /
+                 ("csvio_" + std::string(info->name()) + "_" + std::to_string(std::random_device{}()) + "_" +
+                  std::to_string(counter++) + ".csv");
+    }
+    ~TempCsv()
+    {
+        std::error_code ec;
+        fs::remove(m_path, ec);
+    }
+    TempCsv(const TempCsv&) = delete;
+    TempCsv& operator=(const TempCsv&) = delete;
+
+    std::string str() const { return m_path; }
+
+private:
+    fs::path m_path;
+};
+
+// 16-channel log with a non-numeric tag column, CRLF line endings and
+// (optionally) blank lines
+static void WriteMultiChannel(const TempCsv& file, std::size_t rows, bool blankLines = true)
+{
+    std::ofstream out(file.str(), std::ios::binary | std::ios::trunc);
+    out << "t,tag";
+    for (int c = 0; c < 16; ++c) out << ", ch" << c;
+    out << "\r\n";
+
+    std::mt19937 rng(13);
+    std::normal_distribution<double> dist(0.0, 1.0);
+    out.precision(17);
+    for (std::size_t r = 0; r < rows; ++r)
+    {
+        out << 0.01 * static_cast<double>(r) << ",id" << (r % 5);
+        for (int c = 0; c < 16; ++c) out << "," << (c + dist(rng));
+        out << "\r\n";
+        if (blankLines && r % 97 == 0) out << "\r\n";
+    }
+}
+
+TEST(CsvIO, LoadColumnsMatchesLoadPerColumn)
+{
+    // CsvIO::Load does not skip blank CRLF lines, so leave them out here
+    const TempCsv file;
+    WriteMultiChannel(file, 5000, false);
+    const std::string path = file.str();
+
+    const CsvTable tab = CsvIO::LoadColumns(path, {"ch3", "t", "ch15"});
+    ASSERT_EQ(tab.names, (std::vector<std::string>{"ch3", "t", "ch15"}));
+    ASSERT_EQ(tab.rows, 5000u);
+
+    for (const std::string& name : tab.names)
+    {
+        const CsvSeries s = CsvIO::Load(path, "t", name);
+        ASSERT_EQ(s.y.size(), tab.rows);
+        const double* col = tab.column(name);
+        for (std::size_t r = 0; r < tab.rows; ++r)
+        {
+            ASSERT_DOUBLE_EQ(col[r], s.y[r]) << name << " row " << r;
+        }
+    }
+}
+
+TEST(CsvIO, LoadColumnsAllNumericSkipsTextColumns)
+{
+    const TempCsv file;
+    WriteMultiChannel(file, 100);
+    const std::string path = file.str();
+
+    const CsvTable tab = CsvIO::LoadColumns(path);
+    ASSERT_EQ(tab.names.size(), 17u);
+    EXPECT_EQ(tab.names.front(), "t");
+    EXPECT_EQ(tab.names.back(), "ch15");
+    EXPECT_EQ(tab.rows, 100u);
+    EXPECT_DOUBLE_EQ(tab.column(0)[99], 0.99);
+}
+
+TEST(CsvIO, LoadColumnsParallelEqualsSerial)
+{
+    const TempCsv file;
+    WriteMultiChannel(file, 20000);
+    const std::string path = file.str();
+
+    const CsvTable one = CsvIO::LoadColumns(path, {}, 1);
+    for (unsigned threads : {2u, 7u, 0u})
+    {
+        const CsvTable many = CsvIO::LoadColumns(path, {}, threads);
+        EXPECT_EQ(many.names, one.names);
+        EXPECT_EQ(many.rows, one.rows);
+        EXPECT_EQ(many.data, one.data) << "threads=" << threads;
+    }
+}
+
+TEST(CsvIO, LoadColumnsMissingFieldsAreNaNAndErrorsThrow)
+{
+    const TempCsv file;
+    const std::string path = file.str();
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << "a,b,c\n1,2,3\n4,,6\n7,8\n";
+    }
+
+    const CsvTable tab = CsvIO::LoadColumns(path, {"c", "b"});
+    ASSERT_EQ(tab.rows, 3u);
+    EXPECT_DOUBLE_EQ(tab.column("c")[0], 3.0);
+    EXPECT_TRUE(std::isnan(tab.column("b")[1]));
+    EXPECT_TRUE(std::isnan(tab.column("c")[2]));
+    EXPECT_DOUBLE_EQ(tab.column("b")[2], 8.0);
+
+    EXPECT_THROW(CsvIO::LoadColumns(path, {"zz"}), std::runtime_error);
+    EXPECT_THROW(CsvIO::LoadColumns(path, {"a", "a"}), std::runtime_error);
+    EXPECT_THROW(tab.column("a"), std::runtime_error);
+    EXPECT_THROW(CsvIO::LoadColumns("/nonexistent/file.csv"), std::runtime_error);
+
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << "a,b\n1,2\n3,x\n";
+    }
+    EXPECT_THROW(CsvIO::LoadColumns(path, {"b"}), std::runtime_error);
+    EXPECT_NO_THROW(CsvIO::LoadColumns(path, {"a"}));
+}
+
+TEST(CsvIO, LoadColumnsAllNumericLooksPastBlankFields)
+{
+    const TempCsv file;
+    const std::string path = file.str();
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << "t,a,tag,b,empty\n0,,x,,\n1,2,y,,\n2,3,z,5,\n";
+    }
+
+    // 'a' and 'b' are blank in the first row(s) but numeric; 'empty' never has a value
+    const CsvTable tab = CsvIO::LoadColumns(path);
+    ASSERT_EQ(tab.names, (std::vector<std::string>{"t", "a", "b"}));
+    ASSERT_EQ(tab.rows, 3u);
+    EXPECT_TRUE(std::isnan(tab.column("a")[0]));
+    EXPECT_DOUBLE_EQ(tab.column("a")[2], 3.0);
+    EXPECT_TRUE(std::isnan(tab.column("b")[1]));
+    EXPECT_DOUBLE_EQ(tab.column("b")[2], 5.0);
+}
+
+TEST(CsvIO, LoadColumnsFeedsFilterBank)
+{
+    const TempCsv file;
+    WriteMultiChannel(file, 3000);
+    const std::string path = file.str();
+
+    std::vector<std::string> names;
+    for (int c = 0; c < 16; ++c) names.push_back("ch" + std::to_string(c));
+    CsvTable tab = CsvIO::LoadColumns(path, names, 4);
+
+    Filters::Avg::RunningAverageFilterBank bank(names.size());
+    std::vector<const double*> in(names.size());
+    std::vector<double*> out(names.size());
+    for (std::size_t c = 0; c < names.size(); ++c)
+    {
+        in[c] = tab.column(c);
+        out[c] = tab.column(c);   // in place
+    }
+    bank.process(in.data(), out.data(), tab.rows);
+
+    for (std::size_t c = 0; c < names.size(); ++c)
+    {
+        EXPECT_NEAR(bank.getAverage(c), static_cast<double>(c), 0.1);
+    }
+}
+
+TEST(CsvIO, LoadColumnsSonarAlt)
+{
+    const std::string csvPath = std::string(DATA_DIR) + "/SonarAlt.csv";
+    if (!fs::exists(csvPath))
+    {
+        GTEST_SKIP() << "Input CSV not found at '" << csvPath << "'.";
+    }
+
+    const CsvSeries s = CsvIO::Load(csvPath, "t", "z");
+    const CsvTable tab = CsvIO::LoadColumns(csvPath, {"t", "z"}, 3);
+    ASSERT_EQ(tab.rows, s.y.size());
+    for (std::size_t r = 0; r < tab.rows; ++r)
+    {
+        EXPECT_DOUBLE_EQ(tab.column("t")[r], s.t[r]);
+        EXPECT_DOUBLE_EQ(tab.column("z")[r], s.y[r]);
+    }
+}